@@ -0,0 +1,75 @@
+#define MPI_USE_EXCEPTIONS
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+// Compares the effective bandwidth (uncompressed bytes per second) of plain point-to-point transfers of doubles against compressed ones, and reports the
+// compression ratio of each data set. Compression pays off once the network is slower than the codec, which is not the case within a single node.
+// Usage: mpirun -np 2 compression_benchmark
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  mpi::environment environment(&argc, &argv);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+
+  constexpr std::int32_t iterations = 10;
+  constexpr std::size_t  size       = std::size_t(1) << 23;
+
+  const auto measure = [&] (const auto& function)
+  {
+    communicator.barrier();
+    const auto start = mpi::wall_clock_time();
+    for (std::int32_t i = 0; i < iterations; ++i)
+      function();
+    communicator.barrier();
+    return (mpi::wall_clock_time() - start) / iterations;
+  };
+
+  if (rank == 0)
+    std::cout << std::setw(12) << "data" << std::setw(12) << "ratio" << std::setw(16) << "raw (GB/s)" << std::setw(20) << "compressed (GB/s)" << "\n";
+
+  std::mt19937                     generator(42);
+  std::normal_distribution<double> distribution;
+
+  std::vector<double> smooth(size), noisy(size), sparse(size, 0.0);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    smooth[i] = std::sin(static_cast<double>(i) * 1e-5);
+    noisy [i] = distribution(generator);
+    if (i % 64 == 0)
+      sparse[i] = 1.0;
+  }
+
+  for (const auto& [name, data] : {std::pair<std::string, std::vector<double>*> {"smooth", &smooth}, {"noisy", &noisy}, {"sparse", &sparse}})
+  {
+    std::vector<double> received(size);
+    const auto bytes = static_cast<double>(size * sizeof(double));
+    const auto ratio = bytes / static_cast<double>(mpi::compress(std::as_bytes(std::span(*data)), sizeof(double)).size());
+
+    const auto raw = measure([&]
+    {
+      if      (rank == 0) communicator.send   (*data   , 1);
+      else if (rank == 1) communicator.receive(received, 0);
+    });
+    const auto compressed = measure([&]
+    {
+      if      (rank == 0) communicator.compressed_send   (*data   , 1);
+      else if (rank == 1) communicator.compressed_receive(received, 0);
+    });
+
+    if (rank == 0)
+      std::cout << std::setw(12) << name << std::fixed << std::setprecision(3) << std::setw(12) << ratio
+                << std::setw(16) << bytes / raw * 1e-9 << std::setw(20) << bytes / compressed * 1e-9 << "\n";
+  }
+
+  return 0;
+}
\ No newline at end of file
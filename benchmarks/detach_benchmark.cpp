@@ -0,0 +1,79 @@
+#define MPI_USE_EXCEPTIONS
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+// Measures the latency from the completion of a detached request to the invocation of its callback, and the rate at which the callbacks of many in-flight
+// requests are invoked. The requests are receives matched by sends to self, hence the measurements exclude any network transfer. The main thread yields while
+// waiting, such that the progress thread is scheduled on oversubscribed cores.
+// Usage: mpirun -np 1 detach_benchmark
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  mpi::environment environment(&argc, &argv, mpi::thread_support::multiple);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+
+  if (rank == 0)
+    std::cout << std::setw(10) << "requests" << std::setw(18) << "latency (us)" << std::setw(22) << "completions (1/s)" << "\n";
+
+  {
+    constexpr std::int32_t iterations = 1000;
+
+    std::int32_t        sent     = 0;
+    std::int32_t        received = 0;
+    std::atomic<double> completion_time;
+    std::vector<double> latencies;
+    for (std::int32_t i = 0; i < iterations; ++i)
+    {
+      completion_time = 0.0;
+      auto request = communicator.immediate_receive(received, rank, 0);
+      request.detach([&] (const mpi::status&) { completion_time = mpi::wall_clock_time(); });
+
+      const auto start = mpi::wall_clock_time();
+      communicator.send(sent, rank, 0);
+      while (completion_time == 0.0)
+        std::this_thread::yield();
+      latencies.push_back(completion_time - start);
+    }
+    std::ranges::sort(latencies);
+
+    if (rank == 0)
+      std::cout << std::setw(10) << 1 << std::fixed << std::setprecision(3) << std::setw(18) << latencies[latencies.size() / 2] * 1e6 << std::setw(22) << "-" << "\n";
+  }
+
+  for (const std::size_t count : {std::size_t(100), std::size_t(1000), std::size_t(10000)})
+  {
+    std::vector<std::int32_t>    sent    (count);
+    std::vector<std::int32_t>    received(count);
+    std::vector<mpi::request>    requests;
+    std::atomic<std::size_t>     completed(0);
+    requests.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto request = communicator.immediate_receive(received[i], rank, static_cast<std::int32_t>(i));
+      request.detach([&] (const mpi::status&) { completed.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    const auto start = mpi::wall_clock_time();
+    for (std::size_t i = 0; i < count; ++i)
+      requests.push_back(communicator.immediate_send(sent[i], rank, static_cast<std::int32_t>(i)));
+    mpi::wait_all(requests);
+    while (completed != count)
+      std::this_thread::yield();
+    const auto time = mpi::wall_clock_time() - start;
+
+    if (rank == 0)
+      std::cout << std::setw(10) << count << std::setw(18) << "-" << std::fixed << std::setprecision(0) << std::setw(22) << static_cast<double>(count) / time << "\n";
+  }
+
+  return 0;
+}
\ No newline at end of file
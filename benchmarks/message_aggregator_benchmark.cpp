@@ -0,0 +1,100 @@
+#define MPI_USE_EXCEPTIONS
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+// Compares the rate of small records sent to random destinations as one message each against the rate of a message aggregator.
+// Usage: mpirun -np 4 message_aggregator_benchmark
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  mpi::environment environment(&argc, &argv);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  constexpr std::size_t records = 100000;
+
+  const auto measure = [&] (const auto& function)
+  {
+    communicator.barrier();
+    const auto start = mpi::wall_clock_time();
+    function();
+    communicator.barrier();
+    return mpi::wall_clock_time() - start;
+  };
+
+  if (rank == 0)
+    std::cout << std::setw(10) << "bytes" << std::setw(12) << "count" << std::setw(20) << "raw (records/s)" << std::setw(24) << "aggregated (records/s)" << "\n";
+
+  const auto run = [&] <std::size_t bytes> ()
+  {
+    using record = std::array<std::byte, bytes>;
+
+    std::mt19937                              generator   (rank);
+    std::uniform_int_distribution<std::int32_t> distribution(0, size - 1);
+    std::vector<std::int32_t>                 destinations(records);
+    for (auto& destination : destinations)
+      destination = distribution(generator);
+
+    std::vector<std::int32_t> sent_counts(size, 0), received_counts(size, 0);
+    for (const auto destination : destinations)
+      ++sent_counts[destination];
+    communicator.all_to_all(sent_counts, received_counts);
+    std::size_t expected = 0;
+    for (const auto count : received_counts)
+      expected += count;
+
+    std::size_t sink = 0;
+
+    const auto raw = measure([&]
+    {
+      const record              data    {};
+      record                    incoming{};
+      std::vector<mpi::request> requests;
+      requests.reserve(records);
+      for (const auto destination : destinations)
+        requests.push_back(communicator.immediate_send(data, destination, 0));
+      for (std::size_t i = 0; i < expected; ++i)
+      {
+        communicator.receive(incoming, MPI_ANY_SOURCE, 0);
+        sink += static_cast<std::size_t>(incoming[0]);
+      }
+      static_cast<void>(mpi::wait_all(requests));
+    });
+
+    for (const std::size_t count : {std::size_t(64), std::size_t(1024)})
+    {
+      const auto aggregated = measure([&]
+      {
+        mpi::message_aggregator<record> aggregator(communicator, [&] (const record& incoming, const std::int32_t) { sink += static_cast<std::size_t>(incoming[0]); }, {count, count * bytes, 1e-3});
+        const record data {};
+        for (std::size_t i = 0; i < records; ++i)
+        {
+          aggregator.send(data, destinations[i]);
+          if (i % count == 0)
+            aggregator.progress();
+        }
+        aggregator.synchronize();
+      });
+
+      if (rank == 0)
+        std::cout << std::setw(10) << bytes << std::setw(12) << count << std::fixed << std::setprecision(0)
+                  << std::setw(20) << records / raw << std::setw(24) << records / aggregated << "\n";
+    }
+
+    if (sink != 0)
+      std::cout << "unexpected record contents\n";
+  };
+
+  run.template operator()<24 >();
+  run.template operator()<100>();
+
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#define MPI_USE_EXCEPTIONS
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+// Compares the bandwidth of unsegmented point-to-point and broadcast transfers against their pipelined counterparts.
+// Usage: mpirun -np 2 pipeline_benchmark
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  mpi::environment environment(&argc, &argv);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+
+  constexpr std::int32_t iterations = 10;
+
+  const auto measure = [&] (const auto& function)
+  {
+    communicator.barrier();
+    const auto start = mpi::wall_clock_time();
+    for (std::int32_t i = 0; i < iterations; ++i)
+      function();
+    communicator.barrier();
+    return (mpi::wall_clock_time() - start) / iterations;
+  };
+
+  if (rank == 0)
+    std::cout << std::setw(12) << "bytes" << std::setw(12) << "segment" << std::setw(8) << "depth" << std::setw(16) << "p2p (GB/s)" << std::setw(16) << "bcast (GB/s)" << "\n";
+
+  for (mpi::count bytes = mpi::count(1) << 20; bytes <= mpi::count(1) << 28; bytes <<= 2)
+  {
+    std::vector<char> data(static_cast<std::size_t>(bytes));
+
+    const auto report = [&] (const mpi::count segment, const std::int32_t depth, const double p2p_seconds, const double broadcast_seconds)
+    {
+      if (rank == 0)
+        std::cout << std::setw(12) << bytes << std::setw(12) << segment << std::setw(8) << depth << std::fixed << std::setprecision(3)
+                  << std::setw(16) << bytes / p2p_seconds * 1e-9 << std::setw(16) << bytes / broadcast_seconds * 1e-9 << "\n";
+    };
+
+    const auto p2p = measure([&]
+    {
+      if      (rank == 0) communicator.send   (data, 1);
+      else if (rank == 1) communicator.receive(data, 0);
+    });
+    const auto broadcast = measure([&] { communicator.broadcast(data); });
+    report(bytes, 1, p2p, broadcast);
+
+    for (const mpi::count segment : {mpi::count(1) << 16, mpi::count(1) << 18, mpi::count(1) << 20})
+      for (const std::int32_t depth : {2, 4, 8})
+      {
+        if (segment >= bytes)
+          continue;
+
+        const mpi::pipeline_policy policy {0, segment, depth};
+        const auto pipelined_p2p = measure([&]
+        {
+          if      (rank == 0) communicator.pipelined_send   (data, 1, 0, policy);
+          else if (rank == 1) communicator.pipelined_receive(data, 0, 0, policy);
+        });
+        const auto pipelined_broadcast = measure([&] { communicator.pipelined_broadcast(data, 0, policy); });
+        report(segment, depth, pipelined_p2p, pipelined_broadcast);
+      }
+  }
+
+  return 0;
+}
\ No newline at end of file
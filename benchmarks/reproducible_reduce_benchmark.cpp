@@ -0,0 +1,50 @@
+#define MPI_USE_EXCEPTIONS
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+// Compares the native all_reduce with ops::sum against reproducible_all_reduce on vectors of doubles.
+// The reproducible variant exchanges exact_accumulator::limb_count 64-bit integers per element, hence its cost is dominated by bandwidth for large vectors.
+// Usage: mpirun -np 4 reproducible_reduce_benchmark
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  mpi::environment environment(&argc, &argv);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+
+  constexpr std::int32_t iterations = 20;
+
+  const auto measure = [&] (const auto& function)
+  {
+    communicator.barrier();
+    const auto start = mpi::wall_clock_time();
+    for (std::int32_t i = 0; i < iterations; ++i)
+      function();
+    return (mpi::wall_clock_time() - start) / iterations * 1e6;
+  };
+
+  if (rank == 0)
+    std::cout << std::setw(10) << "elements" << std::setw(16) << "native (us)" << std::setw(20) << "reproducible (us)" << std::setw(10) << "ratio" << "\n";
+
+  for (const std::size_t count : {std::size_t(1), std::size_t(1000), std::size_t(100000)})
+  {
+    std::vector<double> sent    (count);
+    std::vector<double> received(count);
+    for (std::size_t i = 0; i < count; ++i)
+      sent[i] = 1.0 / static_cast<double>(rank + i + 1);
+
+    const auto native       = measure([&] { communicator.all_reduce             (sent, received, mpi::ops::sum); });
+    const auto reproducible = measure([&] { communicator.reproducible_all_reduce(sent, received);                });
+
+    if (rank == 0)
+      std::cout << std::setw(10) << count << std::fixed << std::setprecision(3)
+                << std::setw(16) << native << std::setw(20) << reproducible << std::setw(10) << reproducible / native << "\n";
+  }
+
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#define MPI_USE_EXCEPTIONS
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+// Compares the per-call overhead of the free completion functions over a std::vector<request> against those of a request_set.
+// The requests are inactive persistent requests, hence the measurements exclude any communication.
+// Usage: mpirun -np 1 request_set_benchmark
+std::int32_t main(std::int32_t argc, char** argv)
+{
+  mpi::environment environment(&argc, &argv);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+
+  constexpr std::int32_t iterations = 1000;
+
+  const auto measure = [&] (const auto& function)
+  {
+    const auto start = mpi::wall_clock_time();
+    for (std::int32_t i = 0; i < iterations; ++i)
+      function();
+    return (mpi::wall_clock_time() - start) / iterations * 1e6;
+  };
+
+  if (rank == 0)
+    std::cout << std::setw(10) << "requests" << std::setw(12) << "function" << std::setw(16) << "vector (us)" << std::setw(16) << "set (us)" << "\n";
+
+  for (const std::size_t count : {std::size_t(1), std::size_t(64), std::size_t(10000)})
+  {
+    std::vector<char>         data(count);
+    std::vector<mpi::request> requests;
+    mpi::request_set          request_set(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      requests   .push_back(communicator.persistent_receive(data[i], rank, 0));
+      request_set.insert   (communicator.persistent_receive(data[i], rank, 0));
+    }
+
+    const auto report = [&] (const std::string& function, const double vector_microseconds, const double set_microseconds)
+    {
+      if (rank == 0)
+        std::cout << std::setw(10) << count << std::setw(12) << function << std::fixed << std::setprecision(3)
+                  << std::setw(16) << vector_microseconds << std::setw(16) << set_microseconds << "\n";
+    };
+
+    report("test_all" , measure([&] { static_cast<void>(mpi::test_all (requests)); }), measure([&] { static_cast<void>(request_set.test_all ()); }));
+    report("test_any" , measure([&] { static_cast<void>(mpi::test_any (requests)); }), measure([&] { static_cast<void>(request_set.test_any ()); }));
+    report("test_some", measure([&] { static_cast<void>(mpi::test_some(requests)); }), measure([&] { static_cast<void>(request_set.test_some()); }));
+    report("wait_all" , measure([&] { static_cast<void>(mpi::wait_all (requests)); }), measure([&] { request_set.wait_all (); }));
+    report("wait_some", measure([&] { static_cast<void>(mpi::wait_some(requests)); }), measure([&] { static_cast<void>(request_set.wait_some()); }));
+  }
+
+  return 0;
+}
\ No newline at end of file
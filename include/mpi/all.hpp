@@ -5,6 +5,7 @@
 #include <mpi/core/communicators/communicator.hpp>
 #include <mpi/core/communicators/distributed_graph_communicator.hpp>
 #include <mpi/core/communicators/graph_communicator.hpp>
+#include <mpi/core/communicators/hierarchical_communicator.hpp>
 #include <mpi/core/enums/combiner.hpp>
 #include <mpi/core/enums/comparison.hpp>
 #include <mpi/core/enums/distribution.hpp>
@@ -19,59 +20,86 @@
 #include <mpi/core/error/error_code.hpp>
 #include <mpi/core/error/error_handler.hpp>
 #include <mpi/core/error/standard_error_classes.hpp>
+#include <mpi/core/structs/aggregation_policy.hpp>
+#include <mpi/core/structs/compression_policy.hpp>
 #include <mpi/core/structs/data_type_information.hpp>
 #include <mpi/core/structs/dimension.hpp>
 #include <mpi/core/structs/distributed_array_information.hpp>
 #include <mpi/core/structs/distributed_graph.hpp>
+#include <mpi/core/structs/execution_hint.hpp>
 #include <mpi/core/structs/graph.hpp>
 #include <mpi/core/structs/neighbor_counts.hpp>
 #include <mpi/core/structs/neighbor_information.hpp>
 #include <mpi/core/structs/overhead_type.hpp>
+#include <mpi/core/structs/pipeline_policy.hpp>
 #include <mpi/core/structs/process_set.hpp>
+#include <mpi/core/structs/progress_policy.hpp>
 #include <mpi/core/structs/range.hpp>
 #include <mpi/core/structs/reduction_types.hpp>
 #include <mpi/core/structs/spawn_information.hpp>
 #include <mpi/core/structs/sub_array_information.hpp>
+#include <mpi/core/structs/tag_range.hpp>
 #include <mpi/core/structs/window_information.hpp>
+#include <mpi/core/type/address_data_type.hpp>
 #include <mpi/core/type/compliant_container_traits.hpp>
 #include <mpi/core/type/compliant_traits.hpp>
 #include <mpi/core/type/data_type.hpp>
 #include <mpi/core/type/data_type_traits.hpp>
+#include <mpi/core/type/large_count.hpp>
 #include <mpi/core/type/standard_data_types.hpp>
 #include <mpi/core/type/type_traits.hpp>
 #include <mpi/core/utility/array_traits.hpp>
 #include <mpi/core/utility/associative_container_traits.hpp>
 #include <mpi/core/utility/bitset_enum.hpp>
+#include <mpi/core/utility/cached_attribute.hpp>
 #include <mpi/core/utility/complex_traits.hpp>
+#include <mpi/core/utility/compression.hpp>
 #include <mpi/core/utility/container_adapter.hpp>
+#include <mpi/core/utility/container_packer.hpp>
 #include <mpi/core/utility/container_traits.hpp>
 #include <mpi/core/utility/contiguous.hpp>
 #include <mpi/core/utility/missing_implementation.hpp>
+#include <mpi/core/utility/nested_container.hpp>
 #include <mpi/core/utility/sequential_container_traits.hpp>
 #include <mpi/core/utility/span_traits.hpp>
+#include <mpi/core/utility/termination.hpp>
 #include <mpi/core/utility/tuple_traits.hpp>
+#include <mpi/core/active_message_context.hpp>
+#include <mpi/core/aggregate_op.hpp>
+#include <mpi/core/channel.hpp>
+#include <mpi/core/collective_workspace.hpp>
+#include <mpi/core/communication_plan.hpp>
+#include <mpi/core/compressed_request.hpp>
 #include <mpi/core/environment.hpp>
+#include <mpi/core/exact_accumulator.hpp>
 #include <mpi/core/exception.hpp>
 #include <mpi/core/generalized_request.hpp>
 #include <mpi/core/group.hpp>
 #include <mpi/core/information.hpp>
 #include <mpi/core/key_value.hpp>
 #include <mpi/core/memory.hpp>
+#include <mpi/core/memory_pool.hpp>
 #include <mpi/core/message.hpp>
+#include <mpi/core/message_aggregator.hpp>
 #include <mpi/core/op.hpp>
 #include <mpi/core/port.hpp>
 #include <mpi/core/request.hpp>
+#include <mpi/core/request_set.hpp>
 #include <mpi/core/service.hpp>
 #include <mpi/core/session.hpp>
 #include <mpi/core/standard_ops.hpp>
 #include <mpi/core/status.hpp>
+#include <mpi/core/tag_allocator.hpp>
 #include <mpi/core/time.hpp>
+#include <mpi/core/topology_descriptor.hpp>
 #include <mpi/core/version.hpp>
 #include <mpi/core/window.hpp>
 
+#include <mpi/extensions/coroutine.hpp>
 #include <mpi/extensions/detach.hpp>
 #include <mpi/extensions/future.hpp>
 #include <mpi/extensions/shared_variable.hpp>
+#include <mpi/extensions/thread_pool.hpp>
 
 #include <mpi/io/enums/access_mode.hpp>
 #include <mpi/io/enums/seek_mode.hpp>
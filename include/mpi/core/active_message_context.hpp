@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/type/standard_data_types.hpp>
+#include <mpi/core/utility/termination.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/standard_ops.hpp>
+
+// An active message invokes a handler on the destination process with the payload of the message. The handlers are registered by id, which must denote the
+// same handler and payload type on all processes. Each message consists of the handler id followed by one or more payloads, which are transferred as bytes,
+// hence must be trivially copyable and the processes must share their representation. Sending a batch of payloads invokes the handler once per payload.
+//
+// Sending does not block, hence remote invocations are pipelined rather than performed as request/response pairs; a handler responds by sending an active
+// message to the source itself. Messages are only received and dispatched within progress() and synchronize(), which must be called regularly. Handlers may
+// send active messages, but must not call progress() or synchronize(). The tag must not be used for other messages on the communicator while the context exists.
+namespace mpi
+{
+class active_message_context
+{
+public:
+  using handler_id = std::uint32_t;
+
+  explicit active_message_context  (const communicator& communicator, const std::int32_t tag = 0)
+  : communicator_(communicator)
+  , tag_         (tag)
+  , sent_counts_ (static_cast<std::size_t>(communicator_.size()), 0)
+  {
+
+  }
+  active_message_context           (const active_message_context&  that) = delete ;
+  active_message_context           (      active_message_context&& temp) = default;
+  // Waits for the pending sends, as their buffers are owned by the context.
+  virtual ~active_message_context  () noexcept(false)
+  {
+    for (auto& entry : sends_)
+      entry.request.wait();
+  }
+  active_message_context& operator=(const active_message_context&  that) = delete ;
+  active_message_context& operator=(      active_message_context&& temp) = delete ;
+
+  template <typename payload_type>
+  void        register_handler(const handler_id id, std::function<void(const payload_type& payload, std::int32_t source)> function)
+  {
+    static_assert(std::is_trivially_copyable_v<payload_type>, "Payloads are transferred as bytes, hence must be trivially copyable.");
+
+    if (handlers_.size() <= id)
+      handlers_.resize(static_cast<std::size_t>(id) + 1);
+    handlers_[id] = [function = std::move(function)] (const std::byte* data, const std::size_t size, const std::int32_t source)
+    {
+      payload_type payload;
+      for (std::size_t offset = 0; offset + sizeof(payload_type) <= size; offset += sizeof(payload_type))
+      {
+        std::memcpy(&payload, data + offset, sizeof(payload_type));
+        function(payload, source);
+      }
+    };
+  }
+
+  template <typename payload_type>
+  void        send            (const handler_id id, const payload_type&                payload , const std::int32_t destination)
+  {
+    send(id, std::span<const payload_type>(&payload, 1), destination);
+  }
+  // Invokes the handler once per payload, in order, with a single message.
+  template <typename payload_type>
+  void        send            (const handler_id id, const std::span<const payload_type> payloads, const std::int32_t destination)
+  {
+    static_assert(std::is_trivially_copyable_v<payload_type>, "Payloads are transferred as bytes, hence must be trivially copyable.");
+
+    auto buffer = acquire_buffer(sizeof(handler_id) + payloads.size_bytes());
+    std::memcpy(buffer.data()                     , &id            , sizeof(handler_id));
+    std::memcpy(buffer.data() + sizeof(handler_id), payloads.data(), payloads.size_bytes());
+
+    auto request = communicator_.immediate_send(buffer.data(), static_cast<count>(buffer.size()), data_types::byte, destination, tag_);
+    sends_.push_back({std::move(request), std::move(buffer), destination});
+    ++sent_counts_[destination];
+  }
+
+  // Posts receives for all arrived messages, dispatches the completed ones in order of arrival and recycles the buffers of completed sends. Returns the number
+  // of messages dispatched.
+  std::size_t progress        ()
+  {
+    while (auto probed = communicator_.immediate_probe_message(MPI_ANY_SOURCE, tag_))
+    {
+      auto& [message, status] = *probed;
+      auto  buffer            = acquire_buffer(static_cast<std::size_t>(status.count(data_types::byte)));
+      auto  request           = message.immediate_receive(buffer.data(), static_cast<count>(buffer.size()), data_types::byte);
+      receives_.push_back({std::move(request), std::move(buffer), status.source()});
+    }
+
+    // The received messages are dispatched in order, such that the messages of each source are handled in the order they were sent.
+    std::size_t dispatched = 0;
+    while (dispatched < receives_.size() && receives_[dispatched].request.test())
+    {
+      auto& entry = receives_[dispatched++];
+      dispatch(entry.buffer, entry.process);
+      release_buffer(std::move(entry.buffer));
+    }
+    receives_.erase(receives_.begin(), receives_.begin() + static_cast<std::ptrdiff_t>(dispatched));
+    received_count_ += dispatched;
+
+    std::erase_if(sends_, [&] (auto& entry)
+    {
+      if (!entry.request.test())
+        return false;
+      release_buffer(std::move(entry.buffer));
+      return true;
+    });
+
+    return dispatched;
+  }
+
+  // Collective. Dispatches all active messages sent by any process, including those sent by the handlers in the meantime.
+  void        synchronize     ()
+  {
+    detail::synchronize_message_counts(communicator_, sent_counts_, received_count_, [&] { progress(); });
+
+    for (auto& entry : sends_)
+    {
+      entry.request.wait();
+      release_buffer(std::move(entry.buffer));
+    }
+    sends_.clear();
+  }
+
+protected:
+  struct transfer
+  {
+    mpi::request           request;
+    std::vector<std::byte> buffer ;
+    std::int32_t           process;
+  };
+
+  void                   dispatch      (const std::vector<std::byte>& buffer, const std::int32_t source)
+  {
+    handler_id id;
+    std::memcpy(&id, buffer.data(), sizeof(handler_id));
+    handlers_.at(id)(buffer.data() + sizeof(handler_id), buffer.size() - sizeof(handler_id), source);
+  }
+
+  std::vector<std::byte> acquire_buffer(const std::size_t size)
+  {
+    std::vector<std::byte> result;
+    if (!free_buffers_.empty())
+    {
+      result = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+    result.resize(size);
+    return result;
+  }
+  void                   release_buffer(std::vector<std::byte>&& buffer)
+  {
+    free_buffers_.push_back(std::move(buffer));
+  }
+
+  const communicator&                                                            communicator_  ;
+  std::int32_t                                                                   tag_           ;
+  std::vector<std::function<void(const std::byte*, std::size_t, std::int32_t)>> handlers_      ;
+
+  std::vector<std::uint64_t>                                                     sent_counts_   ; // Per destination, cumulative.
+  std::uint64_t                                                                  received_count_ = 0; // Cumulative.
+
+  std::vector<transfer>                                                          sends_         ;
+  std::vector<transfer>                                                          receives_      ;
+  std::vector<std::vector<std::byte>>                                            free_buffers_  ;
+};
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <mpi/core/type/compliant_traits.hpp>
+#include <mpi/core/utility/array_traits.hpp>
+#include <mpi/core/utility/complex_traits.hpp>
+#include <mpi/core/utility/tuple_traits.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/op.hpp>
+#include <mpi/third_party/pfr.hpp>
+
+// Predefined ops are only applicable to predefined data types, whereas aggregates, tuples and arrays map to derived data types (see type_traits.hpp).
+// Aggregate ops apply a predefined op field by field instead, using the same reflection as the data types. The fields of an array of aggregates are reduced one at
+// a time over all elements, such that each loop performs a single arithmetic operation on a constant stride.
+namespace mpi
+{
+enum class predefined_op
+{
+  sum        ,
+  product    ,
+  minimum    ,
+  maximum    ,
+  logical_and,
+  logical_or ,
+  logical_xor,
+  bitwise_and,
+  bitwise_or ,
+  bitwise_xor
+};
+
+template <predefined_op kind, typename type>
+constexpr bool is_aggregate_op_applicable()
+{
+  if      constexpr (std::is_same_v<type, bool>)
+    return kind >= predefined_op::logical_and;
+  else if constexpr (std::is_integral_v<type>)
+    return true;
+  else if constexpr (std::is_floating_point_v<type>)
+    return kind <= predefined_op::maximum;
+  else if constexpr (is_complex_v<type>)
+    return kind <= predefined_op::product;
+  else if constexpr (is_bounded_array_v<type>)
+    return is_aggregate_op_applicable<kind, std::remove_cvref_t<decltype(std::declval<type&>()[0])>>();
+  else if constexpr (is_tuple_v<type>)
+    return [ ] <std::size_t... index> (std::index_sequence<index...>)
+    {
+      return (is_aggregate_op_applicable<kind, std::tuple_element_t<index, type>>() && ...);
+    } (std::make_index_sequence<std::tuple_size_v<type>>());
+  else if constexpr (is_compliant_aggregate_v<type>)
+    return [ ] <std::size_t... index> (std::index_sequence<index...>)
+    {
+      return (is_aggregate_op_applicable<kind, pfr::tuple_element_t<index, type>>() && ...);
+    } (std::make_index_sequence<pfr::tuple_size_v<type>>());
+  else
+    return false;
+}
+
+template <predefined_op kind, typename type>
+constexpr void apply_aggregate_op(const type& lhs, type& rhs)
+{
+  if      constexpr (std::is_arithmetic_v<type> || is_complex_v<type>)
+  {
+    if      constexpr (kind == predefined_op::sum        ) rhs = lhs + rhs;
+    else if constexpr (kind == predefined_op::product    ) rhs = lhs * rhs;
+    else if constexpr (kind == predefined_op::minimum    ) rhs = std::min(lhs, rhs);
+    else if constexpr (kind == predefined_op::maximum    ) rhs = std::max(lhs, rhs);
+    else if constexpr (kind == predefined_op::logical_and) rhs = static_cast<type>(lhs && rhs);
+    else if constexpr (kind == predefined_op::logical_or ) rhs = static_cast<type>(lhs || rhs);
+    else if constexpr (kind == predefined_op::logical_xor) rhs = static_cast<type>(!lhs != !rhs);
+    else if constexpr (kind == predefined_op::bitwise_and) rhs = static_cast<type>(lhs & rhs);
+    else if constexpr (kind == predefined_op::bitwise_or ) rhs = static_cast<type>(lhs | rhs);
+    else if constexpr (kind == predefined_op::bitwise_xor) rhs = static_cast<type>(lhs ^ rhs);
+  }
+  else if constexpr (is_bounded_array_v<type>)
+  {
+    for (std::size_t i = 0; i < std::size(lhs); ++i)
+      apply_aggregate_op<kind>(lhs[i], rhs[i]);
+  }
+  else if constexpr (is_tuple_v<type>)
+  {
+    [&] <std::size_t... index> (std::index_sequence<index...>)
+    {
+      (apply_aggregate_op<kind>(std::get<index>(lhs), std::get<index>(rhs)), ...);
+    } (std::make_index_sequence<std::tuple_size_v<type>>());
+  }
+  else
+  {
+    [&] <std::size_t... index> (std::index_sequence<index...>)
+    {
+      (apply_aggregate_op<kind>(pfr::get<index>(lhs), pfr::get<index>(rhs)), ...);
+    } (std::make_index_sequence<pfr::tuple_size_v<type>>());
+  }
+}
+
+template <predefined_op kind, typename type>
+void apply_aggregate_op(const type* lhs, type* rhs, const std::size_t size)
+{
+  if constexpr (std::is_arithmetic_v<type> || is_complex_v<type> || is_bounded_array_v<type> || is_tuple_v<type>)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      apply_aggregate_op<kind>(lhs[i], rhs[i]);
+  }
+  else
+  {
+    [&] <std::size_t... index> (std::index_sequence<index...>)
+    {
+      ([&]
+      {
+        for (std::size_t i = 0; i < size; ++i)
+          apply_aggregate_op<kind>(pfr::get<index>(lhs[i]), pfr::get<index>(rhs[i]));
+      } (), ...);
+    } (std::make_index_sequence<pfr::tuple_size_v<type>>());
+  }
+}
+
+template <typename type, predefined_op kind>
+MPI_Op aggregate_op_native()
+{
+  // Not freed, like the key values of cached attributes (see cached_attribute.hpp).
+  static const MPI_Op result = []
+  {
+    MPI_Op op;
+    MPI_CHECK_ERROR_CODE(MPI_Op_create, ([ ] (void* input, void* input_output, std::int32_t* length, MPI_Datatype*)
+    {
+      apply_aggregate_op<kind>(static_cast<const type*>(input), static_cast<type*>(input_output), static_cast<std::size_t>(*length));
+    }, true, &op))
+    return op;
+  } ();
+  return result;
+}
+
+// Returns the aggregate op corresponding to the given op for aggregates, tuples and arrays if it is a predefined op applicable to all of their fields, and the
+// given op otherwise.
+template <typename type>
+op aggregate_op(const op& op)
+{
+  const auto select = [&] <predefined_op kind> () -> MPI_Op
+  {
+    if constexpr (is_aggregate_op_applicable<kind, type>())
+      return aggregate_op_native<type, kind>();
+    else
+      return op.native();
+  };
+
+  if constexpr (std::is_arithmetic_v<type> || std::is_enum_v<type> || is_complex_v<type>)
+    return mpi::op(op.native());
+  else
+  {
+    const auto native = op.native();
+    if (native == MPI_SUM ) return mpi::op(select.template operator()<predefined_op::sum        >());
+    if (native == MPI_PROD) return mpi::op(select.template operator()<predefined_op::product    >());
+    if (native == MPI_MIN ) return mpi::op(select.template operator()<predefined_op::minimum    >());
+    if (native == MPI_MAX ) return mpi::op(select.template operator()<predefined_op::maximum    >());
+    if (native == MPI_LAND) return mpi::op(select.template operator()<predefined_op::logical_and>());
+    if (native == MPI_LOR ) return mpi::op(select.template operator()<predefined_op::logical_or >());
+    if (native == MPI_LXOR) return mpi::op(select.template operator()<predefined_op::logical_xor>());
+    if (native == MPI_BAND) return mpi::op(select.template operator()<predefined_op::bitwise_and>());
+    if (native == MPI_BOR ) return mpi::op(select.template operator()<predefined_op::bitwise_or >());
+    if (native == MPI_BXOR) return mpi::op(select.template operator()<predefined_op::bitwise_xor>());
+    return mpi::op(native);
+  }
+}
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/error/standard_error_classes.hpp>
+#include <mpi/core/structs/tag_range.hpp>
+#include <mpi/core/type/data_type.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/message.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/status.hpp>
+
+// A channel reserves a range of tags on a communicator for the lifetime of the channel (see communicator::allocate_tags), and performs point-to-point
+// operations with tags relative to the range. Components sharing a communicator through channels hence never match each other's messages, without duplicating
+// the communicator. Receives must name a tag within the range, as MPI_ANY_TAG would match the messages of other channels.
+namespace mpi
+{
+class channel
+{
+public:
+  explicit channel  (const communicator& communicator, const std::int32_t tag_count = 1)
+  : communicator_(communicator)
+  {
+    const auto range = communicator_.allocate_tags(tag_count);
+#ifdef MPI_USE_EXCEPTIONS
+    if (!range)
+      throw exception("channel", error::tag);
+#endif
+    range_ = range.value_or(tag_range {});
+  }
+  channel           (const channel&  that) = delete;
+  channel           (      channel&& temp) noexcept
+  : communicator_(temp.communicator_), range_(std::exchange(temp.range_, tag_range {}))
+  {
+
+  }
+  virtual ~channel  ()
+  {
+    if (range_.count > 0)
+      communicator_.release_tags(range_);
+  }
+  channel& operator=(const channel&  that) = delete;
+  channel& operator=(      channel&& temp) = delete;
+
+  // Point-to-point operations, with tags in [0, range().count). The tags of the returned statuses are relative to the range as well.
+  void                                      send                   (const void* data, const count size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    communicator_.send(data, size, data_type, destination, native_tag(tag));
+  }
+  template <typename type>
+  void                                      send                   (const type& data,                                               const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    communicator_.send(data, destination, native_tag(tag));
+  }
+  template <typename type>
+  void                                      synchronous_send       (const type& data,                                               const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    communicator_.synchronous_send(data, destination, native_tag(tag));
+  }
+  [[nodiscard]]
+  request                                   immediate_send         (const void* data, const count size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    return communicator_.immediate_send(data, size, data_type, destination, native_tag(tag));
+  }
+  template <typename type> [[nodiscard]]
+  request                                   immediate_send         (const type& data,                                               const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    return communicator_.immediate_send(data, destination, native_tag(tag));
+  }
+
+  status                                    receive                (      void* data, const count size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    return relative(communicator_.receive(data, size, data_type, source, native_tag(tag)));
+  }
+  template <typename type>
+  status                                    receive                (      type& data,                                               const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0, const bool resize = false) const
+  {
+    return relative(communicator_.receive(data, source, native_tag(tag), resize));
+  }
+  [[nodiscard]]
+  request                                   immediate_receive      (      void* data, const count size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    return communicator_.immediate_receive(data, size, data_type, source, native_tag(tag));
+  }
+  template <typename type> [[nodiscard]]
+  request                                   immediate_receive      (      type& data,                                               const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    return communicator_.immediate_receive(data, source, native_tag(tag));
+  }
+
+  [[nodiscard]]
+  status                                    probe                  (const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    return relative(communicator_.probe(source, native_tag(tag)));
+  }
+  [[nodiscard]]
+  std::optional<status>                     immediate_probe        (const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    auto result = communicator_.immediate_probe(source, native_tag(tag));
+    return result ? relative(*result) : result;
+  }
+  [[nodiscard]]
+  std::pair<message, status>                probe_message          (const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    auto [message, status] = communicator_.probe_message(source, native_tag(tag));
+    return {message, relative(status)};
+  }
+  [[nodiscard]]
+  std::optional<std::pair<message, status>> immediate_probe_message(const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = 0) const
+  {
+    auto result = communicator_.immediate_probe_message(source, native_tag(tag));
+    if (result)
+      result->second = relative(result->second);
+    return result;
+  }
+
+  [[nodiscard]]
+  std::int32_t                              native_tag             (const std::int32_t tag) const
+  {
+#ifdef MPI_USE_EXCEPTIONS
+    if (tag < 0 || tag >= range_.count)
+      throw exception("channel", error::tag);
+#endif
+    return range_.first + tag;
+  }
+  [[nodiscard]]
+  const tag_range&                          range                  () const
+  {
+    return range_;
+  }
+
+protected:
+  [[nodiscard]]
+  status                                    relative               (const status& value) const
+  {
+    auto native = value.native();
+    native.MPI_TAG -= range_.first;
+    return status(native);
+  }
+
+  const communicator& communicator_;
+  tag_range                range_       ;
+};
+}
\ No newline at end of file
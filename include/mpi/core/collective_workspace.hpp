@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// The convenience overloads of the varying collectives determine the sizes and displacements of all processes on each call. A workspace retains these arrays
+// across calls, hence repeated exchanges do not allocate once it has grown to the size of the communicator.
+namespace mpi
+{
+class collective_workspace
+{
+public:
+  explicit collective_workspace  (const std::size_t size = 0)
+  {
+    resize(size);
+  }
+  collective_workspace           (const collective_workspace&  that) = default;
+  collective_workspace           (      collective_workspace&& temp) = default;
+  virtual ~collective_workspace  ()                                  = default;
+  collective_workspace& operator=(const collective_workspace&  that) = default;
+  collective_workspace& operator=(      collective_workspace&& temp) = default;
+
+  void                    resize                (const std::size_t size)
+  {
+    sent_displacements_    .resize(size);
+    received_sizes_        .resize(size);
+    received_displacements_.resize(size);
+  }
+
+  [[nodiscard]]
+  std::span<std::int32_t> sent_displacements    ()
+  {
+    return sent_displacements_;
+  }
+  [[nodiscard]]
+  std::span<std::int32_t> received_sizes        ()
+  {
+    return received_sizes_;
+  }
+  [[nodiscard]]
+  std::span<std::int32_t> received_displacements()
+  {
+    return received_displacements_;
+  }
+
+protected:
+  std::vector<std::int32_t> sent_displacements_    ;
+  std::vector<std::int32_t> received_sizes_        ;
+  std::vector<std::int32_t> received_displacements_;
+};
+}
\ No newline at end of file
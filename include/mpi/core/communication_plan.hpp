@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/type/data_type.hpp>
+#include <mpi/core/utility/container_adapter.hpp>
+#include <mpi/core/aggregate_op.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/op.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/request_set.hpp>
+#include <mpi/core/standard_ops.hpp>
+
+// A communication plan records a repeated exchange pattern once and materializes it into persistent requests, hence each execution amounts to a single
+// MPI_Startall and MPI_Waitall without resolving any arguments. Persistent collectives require MPI 4.0, prior to which the recorded collectives are issued as
+// immediate collectives on each start, in the order they were recorded.
+//
+// The buffers, data types and ops must remain valid for the lifetime of the plan. All processes must record the collectives in the same order.
+//
+// Like the message aggregator, the plan is constructed from a communicator rather than being a member of it, since it records through the communicator's own
+// operations and therefore requires the complete communicator class.
+namespace mpi
+{
+class communication_plan
+{
+public:
+  explicit communication_plan  (const communicator& communicator)
+  : communicator_(communicator)
+  {
+
+  }
+  communication_plan           (const communication_plan&  that) = delete;
+  communication_plan           (      communication_plan&& temp) = default;
+  virtual ~communication_plan  ()                                = default;
+  communication_plan& operator=(const communication_plan&  that) = delete;
+  communication_plan& operator=(      communication_plan&& temp) = delete;
+
+  // Point-to-point operations.
+  communication_plan& send      (const void* data, const count size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0)
+  {
+    requests_.insert(communicator_.persistent_send(data, size, data_type, destination, tag));
+    return *this;
+  }
+  template <typename type>
+  communication_plan& send      (const type& data,                                               const std::int32_t destination, const std::int32_t tag = 0)
+  {
+    using adapter = container_adapter<type>;
+    return send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
+  }
+
+  communication_plan& receive   (      void* data, const count size, const data_type& data_type, const std::int32_t source     , const std::int32_t tag = MPI_ANY_TAG)
+  {
+    requests_.insert(communicator_.persistent_receive(data, size, data_type, source, tag));
+    return *this;
+  }
+  template <typename type>
+  communication_plan& receive   (      type& data,                                               const std::int32_t source     , const std::int32_t tag = MPI_ANY_TAG)
+  {
+    using adapter = container_adapter<type>;
+    return receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), source, tag);
+  }
+
+  // Collective operations.
+  communication_plan& barrier   ()
+  {
+#ifdef MPI_GEQ_4_0
+    requests_.insert(communicator_.persistent_barrier());
+#else
+    collectives_.emplace_back([&communicator = communicator_]
+    {
+      return communicator.immediate_barrier();
+    });
+#endif
+    return *this;
+  }
+
+  communication_plan& broadcast (      void* data, const count size, const data_type& data_type, const std::int32_t root = 0)
+  {
+#ifdef MPI_GEQ_4_0
+    requests_.insert(communicator_.persistent_broadcast(data, size, data_type, root));
+#else
+    collectives_.emplace_back([&communicator = communicator_, data, size, native_data_type = data_type.native(), root]
+    {
+      return communicator.immediate_broadcast(data, size, mpi::data_type(native_data_type), root);
+    });
+#endif
+    return *this;
+  }
+  template <typename type>
+  communication_plan& broadcast (      type& data,                                               const std::int32_t root = 0)
+  {
+    using adapter = container_adapter<type>;
+    return broadcast(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), root);
+  }
+
+  communication_plan& all_reduce(const void* sent, void* received, const count size, const data_type& data_type, const op& op = ops::sum)
+  {
+#ifdef MPI_GEQ_4_0
+    requests_.insert(communicator_.persistent_all_reduce(sent, received, size, data_type, op));
+#else
+    collectives_.emplace_back([&communicator = communicator_, sent, received, size, native_data_type = data_type.native(), native_op = op.native()]
+    {
+      return communicator.immediate_all_reduce(sent, received, size, mpi::data_type(native_data_type), mpi::op(native_op));
+    });
+#endif
+    return *this;
+  }
+  template <typename sent_type, typename received_type>
+  communication_plan& all_reduce(const sent_type& sent, received_type& received,                 const op& op = ops::sum)
+  {
+    using send_adapter    = container_adapter<sent_type    >;
+    using receive_adapter = container_adapter<received_type>;
+    return all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
+  }
+  template <typename type>
+  communication_plan& all_reduce(      type& data,                                               const op& op = ops::sum)
+  {
+    using adapter = container_adapter<type>;
+    return all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
+  }
+
+  communication_plan& all_gather(const void* sent, const count sent_size, const data_type& sent_data_type, void* received, const count received_size, const data_type& received_data_type)
+  {
+#ifdef MPI_GEQ_4_0
+    requests_.insert(communicator_.persistent_all_gather(sent, sent_size, sent_data_type, received, received_size, received_data_type));
+#else
+    collectives_.emplace_back([&communicator = communicator_, sent, sent_size, native_sent_data_type = sent_data_type.native(), received, received_size, native_received_data_type = received_data_type.native()]
+    {
+      return communicator.immediate_all_gather(sent, sent_size, mpi::data_type(native_sent_data_type), received, received_size, mpi::data_type(native_received_data_type));
+    });
+#endif
+    return *this;
+  }
+  template <typename sent_type, typename received_type>
+  communication_plan& all_gather(const sent_type& sent, received_type& received)
+  {
+    using send_adapter    = container_adapter<sent_type    >;
+    using receive_adapter = container_adapter<received_type>;
+    return all_gather(
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter::size(sent)), send_adapter   ::data_type(),
+      receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), receive_adapter::data_type());
+  }
+
+  communication_plan& all_to_all(const void* sent, const count sent_size, const data_type& sent_data_type, void* received, const count received_size, const data_type& received_data_type)
+  {
+#ifdef MPI_GEQ_4_0
+    requests_.insert(communicator_.persistent_all_to_all(sent, sent_size, sent_data_type, received, received_size, received_data_type));
+#else
+    collectives_.emplace_back([&communicator = communicator_, sent, sent_size, native_sent_data_type = sent_data_type.native(), received, received_size, native_received_data_type = received_data_type.native()]
+    {
+      return communicator.immediate_all_to_all(sent, sent_size, mpi::data_type(native_sent_data_type), received, received_size, mpi::data_type(native_received_data_type));
+    });
+#endif
+    return *this;
+  }
+  template <typename sent_type, typename received_type>
+  communication_plan& all_to_all(const sent_type& sent, received_type& received)
+  {
+    using send_adapter    = container_adapter<sent_type    >;
+    using receive_adapter = container_adapter<received_type>;
+    return all_to_all(
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / communicator_.size()), send_adapter   ::data_type(),
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / communicator_.size()), receive_adapter::data_type());
+  }
+
+  // Execution.
+  void                start     ()
+  {
+    requests_.start_all();
+#ifndef MPI_GEQ_4_0
+    collective_requests_.clear();
+    for (const auto& collective : collectives_)
+      collective_requests_.insert(collective());
+#endif
+  }
+  void                wait      ()
+  {
+    requests_           .wait_all();
+#ifndef MPI_GEQ_4_0
+    collective_requests_.wait_all();
+#endif
+  }
+  [[nodiscard]]
+  bool                test      ()
+  {
+#ifdef MPI_GEQ_4_0
+    return requests_.test_all();
+#else
+    return requests_.test_all() && collective_requests_.test_all();
+#endif
+  }
+  void                execute   ()
+  {
+    start();
+    wait ();
+  }
+
+  [[nodiscard]]
+  std::size_t         size      () const
+  {
+#ifdef MPI_GEQ_4_0
+    return requests_.size();
+#else
+    return requests_.size() + collectives_.size();
+#endif
+  }
+
+protected:
+  const communicator&                   communicator_       ;
+  request_set                           requests_           ;
+#ifndef MPI_GEQ_4_0
+  std::vector<std::function<request()>> collectives_        ;
+  request_set                           collective_requests_;
+#endif
+};
+}
\ No newline at end of file
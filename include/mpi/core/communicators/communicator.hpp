@@ -1,10 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <map>
 #include <numeric>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -14,8 +19,22 @@
 #include <mpi/core/enums/split_type.hpp>
 #include <mpi/core/enums/topology.hpp>
 #include <mpi/core/error/error_handler.hpp>
+#include <mpi/core/structs/compression_policy.hpp>
+#include <mpi/core/structs/pipeline_policy.hpp>
 #include <mpi/core/structs/spawn_information.hpp>
+#include <mpi/core/structs/tag_range.hpp>
+#include <mpi/core/type/address_data_type.hpp>
+#include <mpi/core/type/large_count.hpp>
+#include <mpi/core/type/standard_data_types.hpp>
+#include <mpi/core/utility/cached_attribute.hpp>
+#include <mpi/core/utility/compression.hpp>
 #include <mpi/core/utility/container_adapter.hpp>
+#include <mpi/core/utility/container_packer.hpp>
+#include <mpi/core/utility/nested_container.hpp>
+#include <mpi/core/aggregate_op.hpp>
+#include <mpi/core/collective_workspace.hpp>
+#include <mpi/core/compressed_request.hpp>
+#include <mpi/core/exact_accumulator.hpp>
 #include <mpi/core/exception.hpp>
 #include <mpi/core/group.hpp>
 #include <mpi/core/information.hpp>
@@ -26,6 +45,8 @@
 #include <mpi/core/port.hpp>
 #include <mpi/core/standard_ops.hpp>
 #include <mpi/core/request.hpp>
+#include <mpi/core/request_set.hpp>
+#include <mpi/core/tag_allocator.hpp>
 
 namespace mpi
 {
@@ -331,6 +352,18 @@ public:
     MPI_CHECK_ERROR_CODE(MPI_Comm_delete_attr, (native_, key.native()))
   }
 
+  // Allocates a range of tags disjoint from all other ranges allocated on the communicator (see tag_allocator.hpp). Returns std::nullopt if no free range of
+  // the given count exists. The allocator is shared by all communicator objects of the same native communicator, and is not inherited by duplicates.
+  [[nodiscard]]
+  std::optional<tag_range>                  allocate_tags                 (const std::int32_t count) const
+  {
+    return cached_tag_allocator().allocate(count);
+  }
+  void                                      release_tags                  (const tag_range& range) const
+  {
+    cached_tag_allocator().release(range);
+  }
+
   void                                      abort                         (const error_code& error_code) const
   {
     MPI_CHECK_ERROR_CODE(MPI_Abort, (native_, error_code.native()))
@@ -398,154 +431,235 @@ public:
   }
 
   // Point-to-point operations.                                   
-  void                                      send                          (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  void                                      send                          (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Send, (data, size, data_type.native(), destination, tag, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Send_c, (data, size, data_type.native(), destination, tag, native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Send  , (data, large.size(), large.data_type(), destination, tag, native_))
+#endif
   }
   template <typename type>                                                
   void                                      send                          (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
+  }
+  template <packable_container type>
+  void                                      send                          (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    const container_packer<type> packer(data);
+    send(packer.data(), static_cast<count>(packer.size()), packer.data_type(), destination, tag);
+  }
+  template <compliant value_type, typename allocator>
+  void                                      send                          (const std::deque<value_type, allocator>& data,                         const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    send(MPI_BOTTOM, 1, deque_data_type(data), destination, tag);
+  }
+  void                                      send                          (const std::vector<std::string>& data,                                  const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    std::vector<count> header;
+    send(MPI_BOTTOM, 1, string_vector_data_type(data, header), destination, tag);
   }
 
-  void                                      synchronous_send              (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  void                                      synchronous_send              (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Ssend, (data, size, data_type.native(), destination, tag, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ssend_c, (data, size, data_type.native(), destination, tag, native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Ssend  , (data, large.size(), large.data_type(), destination, tag, native_))
+#endif
   }
   template <typename type>                                                
   void                                      synchronous_send              (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    synchronous_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    synchronous_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
 
-  void                                      buffered_send                 (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  void                                      buffered_send                 (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Bsend, (data, size, data_type.native(), destination, tag, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Bsend_c, (data, size, data_type.native(), destination, tag, native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Bsend  , (data, large.size(), large.data_type(), destination, tag, native_))
+#endif
   }
   template <typename type>                                                
   void                                      buffered_send                 (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    buffered_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    buffered_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
 
-  void                                      ready_send                    (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  void                                      ready_send                    (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Rsend, (data, size, data_type.native(), destination, tag, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Rsend_c, (data, size, data_type.native(), destination, tag, native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Rsend  , (data, large.size(), large.data_type(), destination, tag, native_))
+#endif
   }
   template <typename type>                                                
   void                                      ready_send                    (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    ready_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    ready_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
 
   [[nodiscard]]                                                           
-  request                                   immediate_send                (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   immediate_send                (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Isend, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Isend_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Isend  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_send                (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return immediate_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return immediate_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
+  }
+  template <compliant value_type, typename allocator> [[nodiscard]]
+  request                                   immediate_send                (const std::deque<value_type, allocator>& data,                         const std::int32_t destination, const std::int32_t tag = 0) const
+  {
+    return immediate_send(MPI_BOTTOM, 1, deque_data_type(data), destination, tag);
   }
   [[nodiscard]]
-  request                                   immediate_synchronous_send    (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   immediate_synchronous_send    (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Issend, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Issend_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Issend  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]          
   request                                   immediate_synchronous_send    (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return immediate_synchronous_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return immediate_synchronous_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }                                                          
   [[nodiscard]]
-  request                                   immediate_buffered_send       (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   immediate_buffered_send       (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Ibsend, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ibsend_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Ibsend  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]          
   request                                   immediate_buffered_send       (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return immediate_buffered_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return immediate_buffered_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }                                                          
   [[nodiscard]]                                                           
-  request                                   immediate_ready_send          (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   immediate_ready_send          (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Irsend, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Irsend_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Irsend  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_ready_send          (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return immediate_ready_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return immediate_ready_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
 
   [[nodiscard]]                                                           
-  request                                   persistent_send               (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   persistent_send               (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Send_init, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Send_init_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Send_init  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_send               (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return persistent_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return persistent_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
   [[nodiscard]]                                                           
-  request                                   persistent_synchronous_send   (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   persistent_synchronous_send   (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Ssend_init, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ssend_init_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Ssend_init  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_synchronous_send   (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return persistent_synchronous_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return persistent_synchronous_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
   [[nodiscard]]
-  request                                   persistent_buffered_send      (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   persistent_buffered_send      (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Bsend_init, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Bsend_init_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Bsend_init  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]          
   request                                   persistent_buffered_send      (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return persistent_buffered_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return persistent_buffered_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }                                                          
   [[nodiscard]]                                                           
-  request                                   persistent_ready_send         (const void* data, const std::int32_t size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
+  request                                   persistent_ready_send         (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Rsend_init, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Rsend_init_c, (data, size, data_type.native(), destination, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Rsend_init  , (data, large.size(), large.data_type(), destination, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_ready_send         (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0) const
   {
     using adapter = container_adapter<type>;
-    return persistent_ready_send(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, tag);
+    return persistent_ready_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag);
   }
 
 #ifdef MPI_GEQ_4_0 
@@ -564,43 +678,231 @@ public:
   }
 #endif
   
-  status                                    receive                       (      void* data, const std::int32_t size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  status                                    receive                       (      void* data, const count        size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_Recv, (data, size, data_type.native(), source, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Recv_c, (data, size, data_type.native(), source, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Recv  , (data, large.size(), large.data_type(), source, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type>
-  status                                    receive                       (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  status                                    receive                       (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const bool resize = false) const
   {
     using adapter = container_adapter<type>;
-    return receive(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), source, tag);
+
+    if (!resize)
+      return receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), source, tag);
+
+    // The matched probe removes the message from the matching queue, hence it is guaranteed to be the one received after resizing.
+    auto [message, message_status] = probe_message(source, tag);
+    adapter::resize(data, static_cast<std::size_t>(message_status.count_x(adapter::data_type())));
+    return message.receive(data);
+  }
+  template <packable_container type>
+  status                                    receive                       (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const bool resize = false) const
+  {
+    using packer_type = container_packer<type>;
+
+    if (!resize)
+    {
+      packer_type packer(static_cast<std::size_t>(std::distance(data.begin(), data.end())));
+      auto        result = receive(packer.data(), static_cast<count>(packer.size()), packer.data_type(), source, tag);
+      packer.unpack(data);
+      return result;
+    }
+
+    auto [message, message_status] = probe_message(source, tag);
+    packer_type packer(static_cast<std::size_t>(message_status.count(packer_type::data_type())));
+    auto        result = message.receive(packer.data(), static_cast<count>(packer.size()), packer.data_type());
+    packer.unpack(data);
+    return result;
+  }
+  template <compliant value_type, typename allocator>
+  status                                    receive                       (      std::deque<value_type, allocator>& data,                         const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const bool resize = false) const
+  {
+    if (!resize)
+      return receive(MPI_BOTTOM, 1, deque_data_type(data), source, tag);
+
+    auto [message, message_status] = probe_message(source, tag);
+    data.resize(static_cast<std::size_t>(message_status.count(type_traits<value_type>::get_data_type())));
+    return message.receive(MPI_BOTTOM, 1, deque_data_type(data));
+  }
+  // The number and lengths of the strings are not known in advance, hence the container is always resized.
+  status                                    receive                       (      std::vector<std::string>& data,                                  const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  {
+    auto [message, message_status] = probe_message(source, tag);
+    std::vector<char> buffer(static_cast<std::size_t>(message_status.count(data_type(MPI_BYTE))));
+    auto result = message.receive(buffer.data(), static_cast<count>(buffer.size()), data_type(MPI_BYTE));
+    string_vector_unpack(buffer, data);
+    return result;
   }
   [[nodiscard]]
-  request                                   immediate_receive             (      void* data, const std::int32_t size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  request                                   immediate_receive             (      void* data, const count        size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Irecv, (data, size, data_type.native(), source, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Irecv_c, (data, size, data_type.native(), source, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Irecv  , (data, large.size(), large.data_type(), source, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]
   request                                   immediate_receive             (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
   {
     using adapter = container_adapter<type>;
-    return immediate_receive(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), source, tag);
+    return immediate_receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), source, tag);
+  }
+  template <compliant value_type, typename allocator> [[nodiscard]]
+  request                                   immediate_receive             (      std::deque<value_type, allocator>& data,                         const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  {
+    return immediate_receive(MPI_BOTTOM, 1, deque_data_type(data), source, tag);
+  }
+  // Returns std::nullopt if there is no matching message, otherwise resizes the container to the size of the message and starts receiving it.
+  template <typename type> [[nodiscard]]
+  std::optional<request>                    immediate_probe_receive       (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  {
+    using adapter = container_adapter<type>;
+
+    auto probed = immediate_probe_message(source, tag);
+    if (!probed)
+      return std::nullopt;
+
+    auto& [message, message_status] = *probed;
+    adapter::resize(data, static_cast<std::size_t>(message_status.count_x(adapter::data_type())));
+    return message.immediate_receive(data);
   }
   [[nodiscard]]
-  request                                   persistent_receive            (      void* data, const std::int32_t size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
+  request                                   persistent_receive            (      void* data, const count        size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Recv_init, (data, size, data_type.native(), source, tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Recv_init_c, (data, size, data_type.native(), source, tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Recv_init  , (data, large.size(), large.data_type(), source, tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]
   request                                   persistent_receive            (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG) const
   {
     using adapter = container_adapter<type>;
-    return persistent_receive(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), source, tag);
+    return persistent_receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), source, tag);
+  }
+
+  // Pipelined operations split transfers exceeding the threshold of the policy into segments, which are issued as immediate operations.
+  // Each segment is a separate message, hence both sides of a pipelined point-to-point transfer must use the same size and policy.
+  void                                      pipelined_send                (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    if (size <= policy.threshold)
+      return send(data, size, data_type, destination, tag);
+
+    const auto extent = data_type.extent()[1];
+    pipeline(size, policy, [&] (const count offset, const std::int32_t segment_size)
+    {
+      return immediate_send(static_cast<const std::byte*>(data) + offset * extent, segment_size, data_type, destination, tag);
+    });
+  }
+  template <typename type>
+  void                                      pipelined_send                (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    pipelined_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag, policy);
+  }
+  status                                    pipelined_receive             (      void* data, const count        size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    if (size <= policy.threshold)
+      return receive(data, size, data_type, source, tag);
+
+    // The segments of concurrent senders may interleave, hence wildcards are resolved to the sender of the first segment.
+    auto segment_source = source;
+    auto segment_tag    = tag;
+    if (source == MPI_ANY_SOURCE || tag == MPI_ANY_TAG)
+    {
+      const auto first = probe(source, tag);
+      segment_source   = first.source();
+      segment_tag      = first.tag   ();
+    }
+
+    const auto extent = data_type.extent()[1];
+    return pipeline(size, policy, [&] (const count offset, const std::int32_t segment_size)
+    {
+      return immediate_receive(static_cast<std::byte*>(data) + offset * extent, segment_size, data_type, segment_source, segment_tag);
+    });
+  }
+  template <typename type>
+  status                                    pipelined_receive             (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    return pipelined_receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), source, tag, policy);
+  }
+
+  // Compressed operations transfer contiguous data through a lossless codec (see compression.hpp), which is applied to transfers of at least the threshold of
+  // the policy. Both sides must use compressed operations, and the representation of the data must be shared by the processes, as it is transferred as bytes.
+  // The returned statuses describe the compressed messages.
+  void                                      compressed_send               (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0, const compression_policy& policy = compression_policy()) const
+  {
+    const auto extent     = static_cast<std::size_t>(data_type.extent()[1]);
+    const auto compressed = compress({static_cast<const std::byte*>(data), static_cast<std::size_t>(size) * extent}, extent, policy);
+    send(compressed.data(), static_cast<count>(compressed.size()), data_types::byte, destination, tag);
+  }
+  template <typename type>
+  void                                      compressed_send               (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0, const compression_policy& policy = compression_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    compressed_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag, policy);
+  }
+  status                                    compressed_receive            (      void* data, const count        size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const compression_policy& policy = compression_policy()) const
+  {
+    auto [message, message_status] = probe_message(source, tag);
+    return receive_compressed(message, message_status, data, static_cast<std::size_t>(size) * static_cast<std::size_t>(data_type.extent()[1]), policy);
+  }
+  template <typename type>
+  status                                    compressed_receive            (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const bool resize = false, const compression_policy& policy = compression_policy()) const
+  {
+    using adapter = container_adapter<type>;
+
+    const auto extent = static_cast<std::size_t>(adapter::data_type().extent()[1]);
+    auto [message, message_status] = probe_message(source, tag);
+    if (!resize)
+      return receive_compressed(message, message_status, adapter::data(data), adapter::size(data) * extent, policy);
+
+    std::vector<std::byte> buffer(static_cast<std::size_t>(message_status.count(data_types::byte)));
+    message.receive(buffer.data(), static_cast<count>(buffer.size()), data_types::byte);
+    adapter::resize(data, decompressed_size(buffer) / extent);
+    decompress_checked(buffer, adapter::data(data), adapter::size(data) * extent, policy);
+    return message_status;
+  }
+  [[nodiscard]]
+  compressed_request                        immediate_compressed_send     (const void* data, const count        size, const data_type& data_type, const std::int32_t destination, const std::int32_t tag = 0, const compression_policy& policy = compression_policy()) const
+  {
+    const auto extent     = static_cast<std::size_t>(data_type.extent()[1]);
+    auto       compressed = compress({static_cast<const std::byte*>(data), static_cast<std::size_t>(size) * extent}, extent, policy);
+    auto       request    = immediate_send(compressed.data(), static_cast<count>(compressed.size()), data_types::byte, destination, tag);
+    return {std::move(request), std::move(compressed)};
+  }
+  template <typename type> [[nodiscard]]
+  compressed_request                        immediate_compressed_send     (const type& data,                                                      const std::int32_t destination, const std::int32_t tag = 0, const compression_policy& policy = compression_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    return immediate_compressed_send(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, tag, policy);
+  }
+  [[nodiscard]]
+  compressed_request                        immediate_compressed_receive  (      void* data, const count        size, const data_type& data_type, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const compression_policy& policy = compression_policy()) const
+  {
+    return {native_, source, tag, data, static_cast<std::size_t>(size) * static_cast<std::size_t>(data_type.extent()[1]), policy};
+  }
+  template <typename type> [[nodiscard]]
+  compressed_request                        immediate_compressed_receive  (      type& data,                                                      const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG, const compression_policy& policy = compression_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    return immediate_compressed_receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), source, tag, policy);
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
@@ -618,12 +920,19 @@ public:
   }
 #endif
 
-  status                                    send_receive                  (const void*          sent       , const std::int32_t sent_size    , const data_type&   sent_data_type    , const std::int32_t destination                 , const std::int32_t send_tag    ,
-                                                                                 void*          received   , const std::int32_t received_size, const data_type&   received_data_type, const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
+  status                                    send_receive                  (const void*          sent       , const count        sent_size    , const data_type&   sent_data_type    , const std::int32_t destination                 , const std::int32_t send_tag    ,
+                                                                                 void*          received   , const count        received_size, const data_type&   received_data_type, const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_Sendrecv, (sent    , sent_size    , sent_data_type    .native(), destination, send_tag   ,
-                                        received, received_size, received_data_type.native(), source     , receive_tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Sendrecv_c, (sent    , sent_size    , sent_data_type    .native(), destination, send_tag   ,
+                                          received, received_size, received_data_type.native(), source     , receive_tag, native_, &result.native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Sendrecv  , (sent    , sent_large.size()    , sent_large.data_type()    , destination, send_tag   ,
+                                          received, received_large.size(), received_large.data_type(), source     , receive_tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename sent_type, typename received_type>                                                 
@@ -633,14 +942,19 @@ public:
     using send_adapter    = container_adapter<sent_type    >;
     using receive_adapter = container_adapter<received_type>;
     return send_receive(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    )), send_adapter   ::data_type(), destination, send_tag   , 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), receive_adapter::data_type(), source     , receive_tag);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    )), send_adapter   ::data_type(), destination, send_tag   , 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)), receive_adapter::data_type(), source     , receive_tag);
   }                                                                                                                                                             
-  status                                    send_receive_replace          (      void*          data       , const std::int32_t size         , const data_type&   data_type,          const std::int32_t destination                 , const std::int32_t send_tag    ,    
+  status                                    send_receive_replace          (      void*          data       , const count        size         , const data_type&   data_type,          const std::int32_t destination                 , const std::int32_t send_tag    ,    
                                                                                                                                                                                       const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_Sendrecv_replace, (data, size, data_type.native(), destination, send_tag, source, receive_tag, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Sendrecv_replace_c, (data, size, data_type.native(), destination, send_tag, source, receive_tag, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Sendrecv_replace  , (data, large.size(), large.data_type(), destination, send_tag, source, receive_tag, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type>                                                                                                                                          
@@ -648,16 +962,16 @@ public:
                                                                                                                                                                                       const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
   {
     using adapter = container_adapter<type>;
-    return send_receive_replace(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, send_tag, source, receive_tag);
+    return send_receive_replace(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, send_tag, source, receive_tag);
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   immediate_send_receive        (const void*          sent       , const std::int32_t sent_size    , const data_type&   sent_data_type    , const std::int32_t destination                 , const std::int32_t send_tag    , 
-                                                                                 void*          received   , const std::int32_t received_size, const data_type&   received_data_type, const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
+  request                                   immediate_send_receive        (const void*          sent       , const count        sent_size    , const data_type&   sent_data_type    , const std::int32_t destination                 , const std::int32_t send_tag    , 
+                                                                                 void*          received   , const count        received_size, const data_type&   received_data_type, const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Isendrecv, (sent    , sent_size    , sent_data_type    .native(), destination, send_tag   ,
-                                         received, received_size, received_data_type.native(), source     , receive_tag, native_, &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Isendrecv_c, (sent    , sent_size    , sent_data_type    .native(), destination, send_tag   ,
+                                           received, received_size, received_data_type.native(), source     , receive_tag, native_, &result.native_))
     return result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -667,15 +981,15 @@ public:
     using send_adapter    = container_adapter<sent_type    >;
     using receive_adapter = container_adapter<received_type>;
     return immediate_send_receive(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    )), send_adapter   ::data_type(), destination, send_tag    , 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), receive_adapter::data_type(), source     , receive_tag);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    )), send_adapter   ::data_type(), destination, send_tag    , 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)), receive_adapter::data_type(), source     , receive_tag);
   }
   [[nodiscard]]                                                                                                                                                                         
-  request                                   immediate_send_receive_replace(      void*         data        , const std::int32_t size         , const data_type&   data_type,          const std::int32_t destination                 , const std::int32_t send_tag    , 
+  request                                   immediate_send_receive_replace(      void*         data        , const count        size         , const data_type&   data_type,          const std::int32_t destination                 , const std::int32_t send_tag    , 
                                                                                                                                                                                       const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Isendrecv_replace, (data, size, data_type.native(), destination, send_tag, source, receive_tag, native_, &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Isendrecv_replace_c, (data, size, data_type.native(), destination, send_tag, source, receive_tag, native_, &result.native_))
     return result;
   }
   template <typename type> [[nodiscard]]                                                                                                                                                
@@ -683,7 +997,7 @@ public:
                                                                                                                                                                                       const std::int32_t source      = MPI_ANY_SOURCE, const std::int32_t receive_tag = MPI_ANY_TAG) const
   {
     using adapter = container_adapter<type>;
-    return immediate_send_receive_replace(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), destination, send_tag, source, receive_tag);
+    return immediate_send_receive_replace(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), destination, send_tag, source, receive_tag);
   }
 #endif 
 
@@ -743,10 +1057,16 @@ public:
   }
 #endif
 
-  void                                      all_to_all                    (const void*      sent    , const std::int32_t sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*      received, const std::int32_t received_size, const data_type& received_data_type) const
+  void                                      all_to_all                    (const void*      sent    , const count        sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*      received, const count        received_size, const data_type& received_data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Alltoall, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Alltoall_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Alltoall  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), native_))
+#endif
   }
   template <typename sent_type, typename received_type>                            
   void                                      all_to_all                    (const sent_type& sent    , received_type&     received) const
@@ -754,8 +1074,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     all_to_all(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type());
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type());
   }
   template <typename type>                            
   void                                      all_to_all                    (      type&      data    ) const
@@ -763,14 +1083,20 @@ public:
     using adapter = container_adapter<type>;
     all_to_all(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type());
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type());
   }
   [[nodiscard]]                                                           
-  request                                   immediate_all_to_all          (const void*      sent    , const std::int32_t sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*      received, const std::int32_t received_size, const data_type& received_data_type) const
+  request                                   immediate_all_to_all          (const void*      sent    , const count        sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*      received, const count        received_size, const data_type& received_data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Ialltoall, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ialltoall_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, &result.native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Ialltoall  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -779,8 +1105,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return immediate_all_to_all(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type());
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type());
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_all_to_all          (      type&      data    ) const
@@ -788,15 +1114,15 @@ public:
     using adapter = container_adapter<type>;
     return immediate_all_to_all(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type());
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type());
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]                                                           
-  request                                   persistent_all_to_all         (const void*      sent    , const std::int32_t sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*      received, const std::int32_t received_size, const data_type& received_data_type, const mpi::information& info = mpi::information()) const
+  request                                   persistent_all_to_all         (const void*      sent    , const count        sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*      received, const count        received_size, const data_type& received_data_type, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Alltoall_init, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Alltoall_init_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -805,8 +1131,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return persistent_all_to_all(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(),
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type(), info);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(),
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type(), info);
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_all_to_all         (      type&      data,                                  const mpi::information& info = mpi::information()) const
@@ -814,19 +1140,24 @@ public:
     using adapter = container_adapter<type>;
     return persistent_all_to_all(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), info);
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), info);
   }
 #endif
 
-  void                                      all_to_all_varying            (const void*          sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const data_type& received_data_type) const
+  void                                      all_to_all_varying            (const void*          sent    , std::span<const std::int32_t>    sent_sizes    , std::span<const std::int32_t>    sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    received_displacements, const data_type& received_data_type) const
   {
     MPI_CHECK_ERROR_CODE(MPI_Alltoallv, (sent    , sent_sizes    .data(), sent_displacements    .data(), sent_data_type    .native(), 
                                          received, received_sizes.data(), received_displacements.data(), received_data_type.native(), native_))
   }
+  void                                      all_to_all_varying            (const void*          sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const data_type& received_data_type) const
+  {
+    all_to_all_varying(sent, std::span(sent_sizes), std::span(sent_displacements), sent_data_type, received, std::span(received_sizes), std::span(received_displacements), received_data_type);
+  }
   template <typename sent_type, typename received_type>                            
-  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, 
+  void                                      all_to_all_varying            (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , std::span<const std::int32_t>    sent_displacements    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    received_displacements, 
                                                                            const bool           resize  = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -840,8 +1171,15 @@ public:
       receive_adapter::data(received), received_sizes, received_displacements, receive_adapter::data_type());
   }
   template <typename sent_type, typename received_type>                            
-  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, 
+  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, 
+                                                                           const bool           resize  = false) const
+  {
+    all_to_all_varying(sent, std::span(sent_sizes), std::span(sent_displacements), received, std::span(received_sizes), std::span(received_displacements), resize);
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_to_all_varying            (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, 
                                                                            const bool           resize  = false) const
   {
     std::vector<std::int32_t> sent_displacements    (sent_sizes    .size());
@@ -853,6 +1191,13 @@ public:
   }
   template <typename sent_type, typename received_type>                            
   void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, 
+                                                                           const bool           resize  = false) const
+  {
+    all_to_all_varying(sent, std::span(sent_sizes), received, std::span(received_sizes), resize);
+  }
+  template <typename sent_type, typename received_type> requires (!nested_container<received_type>)
+  void                                      all_to_all_varying            (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , 
                                                                                  received_type& received                                                 , 
                                                                            const bool           resize  = false) const
   {
@@ -861,14 +1206,85 @@ public:
 
     all_to_all_varying(sent, sent_sizes, received, received_sizes, resize);
   }
+  template <typename sent_type, typename received_type> requires (!nested_container<received_type>)
+  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , 
+                                                                                 received_type& received                                                 , 
+                                                                           const bool           resize  = false) const
+  {
+    all_to_all_varying(sent, std::span(sent_sizes), received, resize);
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_to_all_varying            (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, 
+                                                                           collective_workspace& workspace, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    std::exclusive_scan(sent_sizes    .begin(), sent_sizes    .end(), workspace.sent_displacements    ().begin(), 0);
+    std::exclusive_scan(received_sizes.begin(), received_sizes.end(), workspace.received_displacements().begin(), 0);
+
+    all_to_all_varying(sent, sent_sizes, workspace.sent_displacements(), received, received_sizes, workspace.received_displacements(), resize);
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_to_all_varying            (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , 
+                                                                                 received_type& received                                                 , 
+                                                                           collective_workspace& workspace, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    all_to_all(sent_sizes.data(), 1, type_traits<std::int32_t>::get_data_type(), workspace.received_sizes().data(), 1, type_traits<std::int32_t>::get_data_type());
+
+    all_to_all_varying(sent, sent_sizes, received, workspace.received_sizes(), workspace, resize);
+  }
+  // Sends sent_sizes[i] consecutive inner containers to the i-th process. Nested containers are always resized, as the lengths of the inner containers are
+  // only known to the sender.
+  template <nested_container sent_type, nested_container received_type>
+  void                                      all_to_all_varying            (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , 
+                                                                                 received_type& received) const
+  {
+    const nested_sender<sent_type> sender      (sent);
+    std::vector<std::size_t>       offsets     (sent_sizes.size() + 1, 0);
+    std::vector<count>             local_sizes (2 * size());
+    std::vector<count>             sizes       (2 * size());
+    std::inclusive_scan(sent_sizes.begin(), sent_sizes.end(), offsets.begin() + 1, std::plus<std::size_t>(), std::size_t(0));
+    for (std::int32_t i = 0; i < size(); ++i)
+    {
+      local_sizes[2 * i    ] = sent_sizes[i];
+      local_sizes[2 * i + 1] = sender.element_count(offsets[i], offsets[i + 1]);
+    }
+    all_to_all(local_sizes.data(), 2, type_traits<count>::get_data_type(), sizes.data(), 2, type_traits<count>::get_data_type());
+
+    nested_receiver<received_type> receiver           (sizes);
+    std::vector<data_type>         sent_data_types    ;
+    std::vector<data_type>         received_data_types;
+    sent_data_types    .reserve(size());
+    received_data_types.reserve(size());
+    for (std::int32_t i = 0; i < size(); ++i)
+    {
+      sent_data_types    .push_back(sender  .data_type(offsets[i], offsets[i + 1]));
+      received_data_types.push_back(receiver.data_type(i));
+    }
+
+    all_to_all_addressed(addresses(sent_data_types), addresses(received_data_types));
+    receiver.unpack(received);
+  }
+  template <nested_container sent_type, nested_container received_type>
+  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , 
+                                                                                 received_type& received) const
+  {
+    all_to_all_varying(sent, std::span(sent_sizes), received);
+  }
   template <typename type>                            
-  void                                      all_to_all_varying            (      type&          data    , const std::vector<std::int32_t>& sizes         , const std::vector<std::int32_t>& displacements) const
+  void                                      all_to_all_varying            (      type&          data    , std::span<const std::int32_t>    sizes         , std::span<const std::int32_t>    displacements) const
   {
     using adapter = container_adapter<type>;
     all_to_all_varying(MPI_IN_PLACE, std::vector<std::int32_t>(), std::vector<std::int32_t>(), data_type(MPI_DATATYPE_NULL), adapter::data(data), sizes, displacements, adapter::data_type());
   }
   template <typename type>                            
-  void                                      all_to_all_varying            (      type&          data    , const std::vector<std::int32_t>& sizes) const
+  void                                      all_to_all_varying            (      type&          data    , const std::vector<std::int32_t>& sizes         , const std::vector<std::int32_t>& displacements) const
+  {
+    all_to_all_varying(data, std::span(sizes), std::span(displacements));
+  }
+  template <typename type>                            
+  void                                      all_to_all_varying            (      type&          data    , std::span<const std::int32_t>    sizes) const
   {
     using adapter = container_adapter<type>;
     
@@ -877,18 +1293,66 @@ public:
 
     all_to_all_varying(MPI_IN_PLACE, std::vector<std::int32_t>(), std::vector<std::int32_t>(), data_type(MPI_DATATYPE_NULL), adapter::data(data), sizes, displacements, adapter::data_type());
   }
+  template <typename type>                            
+  void                                      all_to_all_varying            (      type&          data    , const std::vector<std::int32_t>& sizes) const
+  {
+    all_to_all_varying(data, std::span(sizes));
+  }
+  void                                      all_to_all_varying            (const void*          sent    , const std::vector<count>&        sent_sizes    , const std::vector<aint>&         sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         received_displacements, const data_type& received_data_type) const
+  {
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Alltoallv_c, (sent    , sent_sizes    .data(), sent_displacements    .data(), sent_data_type    .native(), 
+                                           received, received_sizes.data(), received_displacements.data(), received_data_type.native(), native_))
+#else
+    all_to_all_varying_large(sent, sent_sizes, sent_displacements, sent_data_type, received, received_sizes, received_displacements, received_data_type);
+#endif
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<count>&        sent_sizes    , const std::vector<aint>&         sent_displacements    , 
+                                                                                 received_type& received, const std::vector<count>&        received_sizes, const std::vector<aint>&         received_displacements, 
+                                                                           const bool           resize  = false) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+
+    if (resize)
+      receive_adapter::resize(received, std::reduce(received_sizes.begin(), received_sizes.end()));
+
+    all_to_all_varying(
+      send_adapter   ::data(sent    ), sent_sizes    , sent_displacements    , send_adapter   ::data_type(), 
+      receive_adapter::data(received), received_sizes, received_displacements, receive_adapter::data_type());
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_to_all_varying            (const sent_type&     sent    , const std::vector<count>&        sent_sizes    , 
+                                                                                 received_type& received, const std::vector<count>&        received_sizes, 
+                                                                           const bool           resize  = false) const
+  {
+    std::vector<aint> sent_displacements    (sent_sizes    .size());
+    std::vector<aint> received_displacements(received_sizes.size());
+    std::exclusive_scan(sent_sizes    .begin(), sent_sizes    .end(), sent_displacements    .begin(), aint(0));
+    std::exclusive_scan(received_sizes.begin(), received_sizes.end(), received_displacements.begin(), aint(0));
+
+    all_to_all_varying(sent, sent_sizes, sent_displacements, received, received_sizes, received_displacements, resize);
+  }
   [[nodiscard]]
-  request                                   immediate_all_to_all_varying  (const void*          sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const data_type& received_data_type) const
+  request                                   immediate_all_to_all_varying  (const void*          sent    , std::span<const std::int32_t>    sent_sizes    , std::span<const std::int32_t>    sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    received_displacements, const data_type& received_data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
     MPI_CHECK_ERROR_CODE(MPI_Ialltoallv, (sent    , sent_sizes    .data(), sent_displacements    .data(), sent_data_type    .native(), 
                                           received, received_sizes.data(), received_displacements.data(), received_data_type.native(), native_, &result.native_))
     return result;
   }
+  [[nodiscard]]
+  request                                   immediate_all_to_all_varying  (const void*          sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const data_type& received_data_type) const
+  {
+    return immediate_all_to_all_varying(sent, std::span(sent_sizes), std::span(sent_displacements), sent_data_type, received, std::span(received_sizes), std::span(received_displacements), received_data_type);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                           
-  request                                   immediate_all_to_all_varying  (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, 
+  request                                   immediate_all_to_all_varying  (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , std::span<const std::int32_t>    sent_displacements    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    received_displacements, 
                                                                            const bool           resize  = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -901,16 +1365,39 @@ public:
       send_adapter   ::data(sent    ), sent_sizes    , sent_displacements    , send_adapter   ::data_type(), 
       receive_adapter::data(received), received_sizes, received_displacements, receive_adapter::data_type());
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   immediate_all_to_all_varying  (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, 
+                                                                           const bool           resize  = false) const
+  {
+    return immediate_all_to_all_varying(sent, std::span(sent_sizes), std::span(sent_displacements), received, std::span(received_sizes), std::span(received_displacements), resize);
+  }
   template <typename type> [[nodiscard]]                           
-  request                                   immediate_all_to_all_varying  (      type&          data    , const std::vector<std::int32_t>& sizes         , const std::vector<std::int32_t>& displacements) const
+  request                                   immediate_all_to_all_varying  (      type&          data    , std::span<const std::int32_t>    sizes         , std::span<const std::int32_t>    displacements) const
   {
     using adapter = container_adapter<type>;
     return immediate_all_to_all_varying(MPI_IN_PLACE, std::vector<std::int32_t>(), std::vector<std::int32_t>(), data_type(MPI_DATATYPE_NULL), adapter::data(data), sizes, displacements, adapter::data_type());
   }
+  template <typename type> [[nodiscard]]                           
+  request                                   immediate_all_to_all_varying  (      type&          data    , const std::vector<std::int32_t>& sizes         , const std::vector<std::int32_t>& displacements) const
+  {
+    return immediate_all_to_all_varying(data, std::span(sizes), std::span(displacements));
+  }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   persistent_all_to_all_varying (const void*          sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const data_type& received_data_type, 
+  request                                   immediate_all_to_all_varying  (const void*          sent    , const std::vector<count>&        sent_sizes    , const std::vector<aint>&         sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         received_displacements, const data_type& received_data_type) const
+  {
+    request result(MPI_REQUEST_NULL, true);
+    MPI_CHECK_ERROR_CODE(MPI_Ialltoallv_c, (sent    , sent_sizes    .data(), sent_displacements    .data(), sent_data_type    .native(), 
+                                            received, received_sizes.data(), received_displacements.data(), received_data_type.native(), native_, &result.native_))
+    return result;
+  }
+#endif
+#ifdef MPI_GEQ_4_0
+  [[nodiscard]]
+  request                                   persistent_all_to_all_varying (const void*          sent    , std::span<const std::int32_t>    sent_sizes    , std::span<const std::int32_t>    sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    received_displacements, const data_type& received_data_type, 
                                                                            const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
@@ -918,9 +1405,16 @@ public:
                                               received, received_sizes.data(), received_displacements.data(), received_data_type.native(), native_, info.native(), &result.native_))
     return result;
   }
+  [[nodiscard]]
+  request                                   persistent_all_to_all_varying (const void*          sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const data_type& received_data_type, 
+                                                                           const mpi::information& info = mpi::information()) const
+  {
+    return persistent_all_to_all_varying(sent, std::span(sent_sizes), std::span(sent_displacements), sent_data_type, received, std::span(received_sizes), std::span(received_displacements), received_data_type, info);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                           
-  request                                   persistent_all_to_all_varying (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, 
+  request                                   persistent_all_to_all_varying (const sent_type&     sent    , std::span<const std::int32_t>    sent_sizes    , std::span<const std::int32_t>    sent_displacements    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    received_displacements, 
                                                                            const mpi::information& info = mpi::information(), const bool resize = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -933,16 +1427,65 @@ public:
       send_adapter   ::data(sent    ), sent_sizes    , sent_displacements    , send_adapter   ::data_type(), 
       receive_adapter::data(received), received_sizes, received_displacements, receive_adapter::data_type(), info);
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   persistent_all_to_all_varying (const sent_type&     sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, 
+                                                                           const mpi::information& info = mpi::information(), const bool resize = false) const
+  {
+    return persistent_all_to_all_varying(sent, std::span(sent_sizes), std::span(sent_displacements), received, std::span(received_sizes), std::span(received_displacements), info, resize);
+  }
   template <typename type> [[nodiscard]]                           
-  request                                   persistent_all_to_all_varying (      type&          data    , const std::vector<std::int32_t>& sizes         , const std::vector<std::int32_t>& displacements, 
+  request                                   persistent_all_to_all_varying (      type&          data    , std::span<const std::int32_t>    sizes         , std::span<const std::int32_t>    displacements, 
                                                                            const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
     return persistent_all_to_all_varying(MPI_IN_PLACE, std::vector<std::int32_t>(), std::vector<std::int32_t>(), data_type(MPI_DATATYPE_NULL), adapter::data(data), sizes, displacements, adapter::data_type(), info);
   }
+  template <typename type> [[nodiscard]]                           
+  request                                   persistent_all_to_all_varying (      type&          data    , const std::vector<std::int32_t>& sizes         , const std::vector<std::int32_t>& displacements, 
+                                                                           const mpi::information& info = mpi::information()) const
+  {
+    return persistent_all_to_all_varying(data, std::span(sizes), std::span(displacements), info);
+  }
 #endif
 
-  // The alltoallw is the only family of functions that do not have convenience wrappers (because it just cannot be made convenient).
+  // Sends each container to the process it is mapped to and returns the containers received, mapped to their sources. The processes do not know their sources
+  // in advance, yet no counts are exchanged among all processes (NBX): each process receives until the non-blocking barrier completes, which it enters once
+  // its synchronous sends have been matched, hence the cost scales with the number of neighbors rather than the size of the communicator.
+  // Messages of an exchange may be matched by a preceding exchange still awaiting its barrier, hence consecutive exchanges must use distinct tags.
+  template <typename type>
+  std::map<std::int32_t, type>              sparse_all_to_all             (const std::map<std::int32_t, type>& sent, const std::int32_t tag = 0) const
+  {
+    using adapter = container_adapter<type>;
+
+    request_set requests(sent.size());
+    for (const auto& [destination, data] : sent)
+      requests.insert(immediate_synchronous_send(data, destination, tag));
+
+    std::map<std::int32_t, type> result ;
+    std::optional<request>       barrier;
+    while (true)
+    {
+      if (auto probed = immediate_probe_message(MPI_ANY_SOURCE, tag))
+      {
+        auto& [message, message_status] = *probed;
+        auto& data = result[message_status.source()];
+        adapter::resize(data, static_cast<std::size_t>(message_status.count_x(adapter::data_type())));
+        message.receive(data);
+      }
+
+      if      (barrier)
+      {
+        if (barrier->test())
+          break;
+      }
+      else if (requests.test_all())
+        barrier.emplace(immediate_barrier());
+    }
+    return result;
+  }
+
+  // The alltoallw is the only family of functions that do not have convenience wrappers (because it just cannot be made convenient).
   void                                      all_to_all_general            (const void* sent    , const std::vector<std::int32_t>& sent_sizes    , const std::vector<std::int32_t>& sent_displacements    , const std::vector<MPI_Datatype>& sent_data_types    ,
                                                                                  void* received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& received_displacements, const std::vector<MPI_Datatype>& received_data_types) const
   {
@@ -970,10 +1513,16 @@ public:
   }
 #endif
 
-  void                                      all_gather                    (const void*          sent    , const std::int32_t               sent_size     ,                                                const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t               received_size ,                                                const data_type& received_data_type) const
+  void                                      all_gather                    (const void*          sent    , const count                      sent_size     ,                                                const data_type& sent_data_type    ,
+                                                                                 void*          received, const count                      received_size ,                                                const data_type& received_data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Allgather, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Allgather_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Allgather  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), native_))
+#endif
   }
   template <typename sent_type, typename received_type>                            
   void                                      all_gather                    (const sent_type&     sent    , 
@@ -982,8 +1531,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     all_gather(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type());
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type());
   }
   template <typename type>                            
   void                                      all_gather                    (      type&          data    ) const
@@ -991,14 +1540,20 @@ public:
     using adapter = container_adapter<type>;
     all_gather(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type());
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type());
   }
   [[nodiscard]]                                                           
-  request                                   immediate_all_gather          (const void*          sent    , const std::int32_t               sent_size     ,                                                const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t               received_size ,                                                const data_type& received_data_type) const
+  request                                   immediate_all_gather          (const void*          sent    , const count                      sent_size     ,                                                const data_type& sent_data_type    ,
+                                                                                 void*          received, const count                      received_size ,                                                const data_type& received_data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Iallgather, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Iallgather_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, &result.native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Iallgather  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -1008,8 +1563,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return immediate_all_gather(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type());
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type());
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_all_gather          (      type&          data    ) const
@@ -1017,15 +1572,15 @@ public:
     using adapter = container_adapter<type>;
     return immediate_all_gather(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type());
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type());
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]                                                           
-  request                                   persistent_all_gather         (const void*          sent     , const std::int32_t sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*          received , const std::int32_t received_size, const data_type& received_data_type, const mpi::information& info = mpi::information()) const
+  request                                   persistent_all_gather         (const void*          sent     , const count        sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*          received , const count        received_size, const data_type& received_data_type, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Allgather_init, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Allgather_init_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -1035,8 +1590,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return persistent_all_gather(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent             )), send_adapter   ::data_type(),
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type(), info);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent             )), send_adapter   ::data_type(),
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type(), info);
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_all_gather         (      type&          data     , const mpi::information& info = mpi::information()) const
@@ -1044,18 +1599,23 @@ public:
     using adapter = container_adapter<type>;
     return persistent_all_gather(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), info);
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), info);
   }
 #endif
 
   void                                      all_gather_varying            (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type) const
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, const data_type& received_data_type) const
   {
     MPI_CHECK_ERROR_CODE(MPI_Allgatherv, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), native_))
   }
+  void                                      all_gather_varying            (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type) const
+  {
+    all_gather_varying(sent, sent_size, sent_data_type, received, std::span(received_sizes), std::span(displacements), received_data_type);
+  }
   template <typename sent_type, typename received_type>                            
   void                                      all_gather_varying            (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
                                                                            const bool           resize  = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1070,7 +1630,14 @@ public:
   }
   template <typename sent_type, typename received_type>                            
   void                                      all_gather_varying            (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const bool           resize  = false) const
+  {
+    all_gather_varying(sent, received, std::span(received_sizes), std::span(displacements), resize);
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, 
                                                                            const bool           resize  = false) const
   {
     std::vector<std::int32_t> displacements(received_sizes.size());
@@ -1079,6 +1646,13 @@ public:
     all_gather_varying(sent, received, received_sizes, displacements, resize);
   }
   template <typename sent_type, typename received_type>                            
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, 
+                                                                           const bool           resize  = false) const
+  {
+    all_gather_varying(sent, received, std::span(received_sizes), resize);
+  }
+  template <typename sent_type, typename received_type> requires (!nested_container<received_type>)
   void                                      all_gather_varying            (const sent_type&     sent    , 
                                                                                  received_type& received, 
                                                                            const bool           resize  = false) const
@@ -1089,20 +1663,71 @@ public:
 
     all_gather_varying(sent, received, received_sizes, resize);
   }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, 
+                                                                           collective_workspace& workspace, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    std::exclusive_scan(received_sizes.begin(), received_sizes.end(), workspace.received_displacements().begin(), 0);
+
+    all_gather_varying(sent, received, received_sizes, workspace.received_displacements(), resize);
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received, 
+                                                                           collective_workspace& workspace, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    const auto local_size = static_cast<std::int32_t>(container_adapter<sent_type>::size(sent));
+    all_gather(&local_size, 1, type_traits<std::int32_t>::get_data_type(), workspace.received_sizes().data(), 1, type_traits<std::int32_t>::get_data_type());
+
+    all_gather_varying(sent, received, workspace.received_sizes(), workspace, resize);
+  }
+  // Nested containers are always resized, as the lengths of the inner containers are only known to the sender.
+  template <nested_container sent_type, nested_container received_type>
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received) const
+  {
+    const nested_sender<sent_type> sender       (sent);
+    const count                    local_sizes[] {sender.size(), sender.element_count(0, sent.size())};
+    std::vector<count>             sizes        (2 * size());
+    all_gather(local_sizes, 2, type_traits<count>::get_data_type(), sizes.data(), 2, type_traits<count>::get_data_type());
+
+    nested_receiver<received_type> receiver           (sizes);
+    const auto                     sent_data_type     (sender.data_type(0, sent.size()));
+    std::vector<data_type>         received_data_types;
+    received_data_types.reserve(size());
+    for (std::int32_t i = 0; i < size(); ++i)
+      received_data_types.push_back(receiver.data_type(i));
+
+    all_to_all_addressed(std::vector(size(), &sent_data_type), addresses(received_data_types));
+    receiver.unpack(received);
+  }
   template <typename type>                            
-  void                                      all_gather_varying            (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements) const
+  void                                      all_gather_varying            (      type&          data    , std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements) const
   {
     using adapter = container_adapter<type>;
 
     all_gather_varying(MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), adapter::data(data), received_sizes, displacements, adapter::data_type());
   }
   template <typename type>                            
-  void                                      all_gather_varying            (      type&          data    , const std::vector<std::int32_t>& received_sizes) const
+  void                                      all_gather_varying            (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements) const
+  {
+    all_gather_varying(data, std::span(received_sizes), std::span(displacements));
+  }
+  template <typename type>                            
+  void                                      all_gather_varying            (      type&          data    , std::span<const std::int32_t>    received_sizes) const
   {
     std::vector<std::int32_t> displacements(received_sizes.size());
     std::exclusive_scan(received_sizes.begin(), received_sizes.end(), displacements.begin(), 0);
     all_gather_varying(data, received_sizes, displacements);
   }
+  template <typename type>                            
+  void                                      all_gather_varying            (      type&          data    , const std::vector<std::int32_t>& received_sizes) const
+  {
+    all_gather_varying(data, std::span(received_sizes));
+  }
   template <typename type>
   void                                      all_gather_varying            (      type&          data    ) const
   {
@@ -1114,17 +1739,77 @@ public:
 
     all_gather_varying(data, received_sizes);
   }
+  void                                      all_gather_varying            (const void*          sent    , const count                      sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         displacements, const data_type& received_data_type) const
+  {
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Allgatherv_c, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), native_))
+#else
+    const auto         local_rank        = static_cast<std::size_t>(rank());
+    const auto         communicator_size = static_cast<std::size_t>(size());
+    std::vector<count> sent_sizes        (communicator_size, sent_size);
+    std::vector<aint>  sent_displacements(communicator_size, 0);
+    std::vector<count> gathered_sizes    (received_sizes);
+
+    if (sent == MPI_IN_PLACE)
+    {
+      // Each process sends a copy of its own block, since the send and receive buffers of MPI_Alltoallw must not overlap, and does not receive it from itself.
+      const auto             extent = static_cast<std::size_t>(received_data_type.extent()[1]);
+      const auto             offset = static_cast<std::size_t>(displacements[local_rank]) * extent;
+      std::vector<std::byte> block  (static_cast<std::size_t>(received_sizes[local_rank]) * extent);
+      std::copy_n(static_cast<const std::byte*>(received) + offset, block.size(), block.begin());
+
+      std::fill(sent_sizes.begin(), sent_sizes.end(), received_sizes[local_rank]);
+      sent_sizes    [local_rank] = 0;
+      gathered_sizes[local_rank] = 0;
+      all_to_all_varying_large(block.data(), sent_sizes, sent_displacements, received_data_type, received, gathered_sizes, displacements, received_data_type);
+    }
+    else
+      all_to_all_varying_large(sent    , sent_sizes, sent_displacements, sent_data_type    , received, gathered_sizes, displacements, received_data_type);
+#endif
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<count>&        received_sizes, const std::vector<aint>&         displacements, 
+                                                                           const bool           resize  = false) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+
+    if (resize)
+      receive_adapter::resize(received, std::reduce(received_sizes.begin(), received_sizes.end()));
+
+    all_gather_varying(
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter::size(sent)), send_adapter   ::data_type(), 
+      receive_adapter::data(received), received_sizes, displacements               , receive_adapter::data_type());
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      all_gather_varying            (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<count>&        received_sizes, 
+                                                                           const bool           resize  = false) const
+  {
+    std::vector<aint> displacements(received_sizes.size());
+    std::exclusive_scan(received_sizes.begin(), received_sizes.end(), displacements.begin(), aint(0));
+
+    all_gather_varying(sent, received, received_sizes, displacements, resize);
+  }
   [[nodiscard]]
   request                                   immediate_all_gather_varying  (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type) const
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, const data_type& received_data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
     MPI_CHECK_ERROR_CODE(MPI_Iallgatherv, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), native_, &result.native_))
     return  result;
   }
+  [[nodiscard]]
+  request                                   immediate_all_gather_varying  (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type) const
+  {
+    return immediate_all_gather_varying(sent, sent_size, sent_data_type, received, std::span(received_sizes), std::span(displacements), received_data_type);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                           
   request                                   immediate_all_gather_varying  (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
                                                                            const bool           resize  = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1137,26 +1822,55 @@ public:
       send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter   ::data_type(), 
       receive_adapter::data(received), received_sizes, displacements                      , receive_adapter::data_type());
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   immediate_all_gather_varying  (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const bool           resize  = false) const
+  {
+    return immediate_all_gather_varying(sent, received, std::span(received_sizes), std::span(displacements), resize);
+  }
   template <typename type> [[nodiscard]]                           
-  request                                   immediate_all_gather_varying  (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements) const
+  request                                   immediate_all_gather_varying  (      type&          data    , std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements) const
   {
     using adapter = container_adapter<type>;
 
     return immediate_all_gather_varying(MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), adapter::data(data), received_sizes, displacements, adapter::data_type());
   }
+  template <typename type> [[nodiscard]]                           
+  request                                   immediate_all_gather_varying  (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements) const
+  {
+    return immediate_all_gather_varying(data, std::span(received_sizes), std::span(displacements));
+  }
+#ifdef MPI_GEQ_4_0
+  [[nodiscard]]
+  request                                   immediate_all_gather_varying  (const void*          sent    , const count                      sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         displacements, const data_type& received_data_type) const
+  {
+    request result(MPI_REQUEST_NULL, true);
+    MPI_CHECK_ERROR_CODE(MPI_Iallgatherv_c, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), native_, &result.native_))
+    return result;
+  }
+#endif
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
   request                                   persistent_all_gather_varying (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, const data_type& received_data_type, 
                                                                            const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
     MPI_CHECK_ERROR_CODE(MPI_Allgatherv_init, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), native_, info.native(), &result.native_))
     return  result;
   }
+  [[nodiscard]]
+  request                                   persistent_all_gather_varying (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                           const mpi::information& info = mpi::information()) const
+  {
+    return persistent_all_gather_varying(sent, sent_size, sent_data_type, received, std::span(received_sizes), std::span(displacements), received_data_type, info);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                           
   request                                   persistent_all_gather_varying (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
                                                                            const mpi::information& info = mpi::information(), const bool resize = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1169,38 +1883,63 @@ public:
       send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter   ::data_type(), 
       receive_adapter::data(received), received_sizes, displacements                      , receive_adapter::data_type(), info);
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   persistent_all_gather_varying (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const mpi::information& info = mpi::information(), const bool resize = false) const
+  {
+    return persistent_all_gather_varying(sent, received, std::span(received_sizes), std::span(displacements), info, resize);
+  }
   template <typename type> [[nodiscard]]                           
-  request                                   persistent_all_gather_varying (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+  request                                   persistent_all_gather_varying (      type&          data    , std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
                                                                            const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
 
     return persistent_all_gather_varying(MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), adapter::data(data), received_sizes, displacements, adapter::data_type(), info);
   }
+  template <typename type> [[nodiscard]]                           
+  request                                   persistent_all_gather_varying (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const mpi::information& info = mpi::information()) const
+  {
+    return persistent_all_gather_varying(data, std::span(received_sizes), std::span(displacements), info);
+  }
 #endif
 
-  void                                      all_reduce                     (const void*      sent, void*          received, const std::int32_t               size , const data_type& data_type, const op& op = ops::sum) const
+  void                                      all_reduce                     (const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Allreduce, (sent, received, size, data_type.native(), op.native(), native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Allreduce_c, (sent, received, size, data_type.native(), op.native(), native_))
+#else
+    if (is_large_count(size))
+      pipelined_all_reduce(sent, received, size, data_type, op);
+    else
+      MPI_CHECK_ERROR_CODE(MPI_Allreduce  , (sent, received, static_cast<std::int32_t>(size), data_type.native(), op.native(), native_))
+#endif
   }
   template <typename sent_type, typename received_type>
   void                                      all_reduce                     (const sent_type& sent, received_type& received,                                                                     const op& op = ops::sum) const
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type>                            
   void                                      all_reduce                     (      type&      data,                                                                                              const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
   [[nodiscard]]
-  request                                   immediate_all_reduce           (const void*      sent, void*          received, const std::int32_t               size , const data_type& data_type, const op& op = ops::sum) const
+  request                                   immediate_all_reduce           (const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Iallreduce, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Iallreduce_c, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Iallreduce  , (sent, received, large.size(), large.data_type(), large.op(), native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1208,20 +1947,68 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return immediate_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    return immediate_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type> [[nodiscard]]                           
   request                                   immediate_all_reduce           (      type&      data,                                                                                              const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    return immediate_all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    return immediate_all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
+  }
+  void                                      pipelined_all_reduce           (const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    if (size <= policy.threshold)
+      return all_reduce(sent, received, size, data_type, op);
+
+    const auto extent = data_type.extent()[1];
+    pipeline(size, policy, [&] (const count offset, const std::int32_t segment_size)
+    {
+      return immediate_all_reduce(
+        sent == MPI_IN_PLACE ? MPI_IN_PLACE : static_cast<const std::byte*>(sent) + offset * extent, 
+        static_cast<std::byte*>(received) + offset * extent, segment_size, data_type, op);
+    });
+  }
+  template <typename sent_type, typename received_type>
+  void                                      pipelined_all_reduce           (const sent_type& sent, received_type& received,                                                                     const op& op = ops::sum, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+    pipelined_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), policy);
+  }
+  template <typename type>                            
+  void                                      pipelined_all_reduce           (      type&      data,                                                                                              const op& op = ops::sum, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    pipelined_all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), policy);
+  }
+  // Sums independent of the number of processes and the reduction order, at the cost of exchanging exact accumulators (see exact_accumulator.hpp).
+  template <std::floating_point type>
+  void                                      reproducible_all_reduce        (const type*      sent, type*          received, const count                      size                                                   ) const
+  {
+    reduce_exactly(sent, received, size, true, [&] (std::int64_t* limbs, const count limb_count)
+    {
+      all_reduce(MPI_IN_PLACE, limbs, limb_count, type_traits<std::int64_t>::get_data_type(), ops::sum);
+    });
+  }
+  template <typename sent_type, typename received_type> requires std::floating_point<typename container_adapter<sent_type>::value_type>
+  void                                      reproducible_all_reduce        (const sent_type& sent, received_type& received                                                                                          ) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+    reproducible_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)));
+  }
+  template <typename type> requires std::floating_point<typename container_adapter<type>::value_type>
+  void                                      reproducible_all_reduce        (      type&      data                                                                                                                   ) const
+  {
+    using adapter = container_adapter<type>;
+    reproducible_all_reduce(adapter::data(data), adapter::data(data), static_cast<count>(adapter::size(data)));
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   persistent_all_reduce          (const void*      sent, void*          received, const std::int32_t               size , const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
+  request                                   persistent_all_reduce          (const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Allreduce_init, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Allreduce_init_c, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1229,13 +2016,13 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return persistent_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op, info);
+    return persistent_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), info);
   }
   template <typename type> [[nodiscard]]                           
   request                                   persistent_all_reduce          (      type&      data,                                                                                              const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, info);
+    return persistent_all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), info);
   }
 #endif
 
@@ -1248,13 +2035,13 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    reduce_scatter(send_adapter::data(sent), receive_adapter::data(received), sizes, send_adapter::data_type(), op);
+    reduce_scatter(send_adapter::data(sent), receive_adapter::data(received), sizes, send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type>                            
   void                                      reduce_scatter                 (      type&      data,                          const std::vector<std::int32_t>& sizes,                             const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    reduce_scatter(MPI_IN_PLACE, adapter::data(data), sizes, adapter::data_type(), op);
+    reduce_scatter(MPI_IN_PLACE, adapter::data(data), sizes, adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
   [[nodiscard]]
   request                                   immediate_reduce_scatter       (const void*      sent, void*          received, const std::vector<std::int32_t>& sizes, const data_type& data_type, const op& op = ops::sum) const
@@ -1268,13 +2055,13 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return immediate_reduce_scatter(send_adapter::data(sent), receive_adapter::data(received), sizes, send_adapter::data_type(), op);
+    return immediate_reduce_scatter(send_adapter::data(sent), receive_adapter::data(received), sizes, send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type> [[nodiscard]]                           
   request                                   immediate_reduce_scatter       (      type&      data,                          const std::vector<std::int32_t>& sizes,                             const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    return immediate_reduce_scatter(MPI_IN_PLACE, adapter::data(data), sizes, adapter::data_type(), op);
+    return immediate_reduce_scatter(MPI_IN_PLACE, adapter::data(data), sizes, adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
@@ -1289,38 +2076,48 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return persistent_reduce_scatter(send_adapter::data(sent), receive_adapter::data(received), sizes, send_adapter::data_type(), op, info);
+    return persistent_reduce_scatter(send_adapter::data(sent), receive_adapter::data(received), sizes, send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), info);
   }
   template <typename type> [[nodiscard]]                           
   request                                   persistent_reduce_scatter      (      type&      data,                          const std::vector<std::int32_t>& sizes,                             const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_reduce_scatter(MPI_IN_PLACE, adapter::data(data), sizes, adapter::data_type(), op, info);
+    return persistent_reduce_scatter(MPI_IN_PLACE, adapter::data(data), sizes, adapter::data_type(), aggregate_op<typename adapter::value_type>(op), info);
   }
 #endif
 
-  void                                      reduce_scatter_block           (const void*      sent, void*          received, const std::int32_t               size , const data_type& data_type, const op& op = ops::sum) const
+  void                                      reduce_scatter_block           (const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Reduce_scatter_block, (sent, received, size, data_type.native(), op.native(), native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_scatter_block_c, (sent, received, size, data_type.native(), op.native(), native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_scatter_block  , (sent, received, large.size(), large.data_type(), large.op(), native_))
+#endif
   }
   template <typename sent_type, typename received_type>
   void                                      reduce_scatter_block           (const sent_type& sent, received_type& received,                                                                     const op& op = ops::sum) const
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    reduce_scatter_block(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), send_adapter::data_type(), op);
+    reduce_scatter_block(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type>                            
   void                                      reduce_scatter_block           (      type&      data,                                                                                              const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    reduce_scatter_block(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    reduce_scatter_block(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
   [[nodiscard]]
-  request                                   immediate_reduce_scatter_block (const void*      sent, void*          received, const std::int32_t               size , const data_type& data_type, const op& op = ops::sum) const
+  request                                   immediate_reduce_scatter_block (const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Ireduce_scatter_block, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ireduce_scatter_block_c, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Ireduce_scatter_block  , (sent, received, large.size(), large.data_type(), large.op(), native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1328,20 +2125,20 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return immediate_reduce_scatter_block(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), send_adapter::data_type(), op);
+    return immediate_reduce_scatter_block(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type> [[nodiscard]]                           
   request                                   immediate_reduce_scatter_block (      type&      data,                                                                                              const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    return immediate_reduce_scatter_block(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    return immediate_reduce_scatter_block(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   persistent_reduce_scatter_block(const void*      sent, void*          received, const std::int32_t               size , const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
+  request                                   persistent_reduce_scatter_block(const void*      sent, void*          received, const count                      size , const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Reduce_scatter_block_init, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_scatter_block_init_c, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1349,23 +2146,29 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return persistent_reduce_scatter_block(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), send_adapter::data_type(), op, info);
+    return persistent_reduce_scatter_block(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), info);
   }
   template <typename type> [[nodiscard]]                           
   request                                   persistent_reduce_scatter_block(      type&      data,                                                                                              const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_reduce_scatter_block(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, info);
+    return persistent_reduce_scatter_block(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), info);
   }
 #endif
 
   // All to one collective operations.
 
-  void                                      gather                        (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t               received_size ,                                                 const data_type& received_data_type, 
+  void                                      gather                        (const void*          sent    , const count                      sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const count                      received_size ,                                                 const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Gather, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Gather_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Gather  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), root, native_))
+#endif
   }
   template <typename sent_type, typename received_type>                            
   void                                      gather                        (const sent_type&     sent    , 
@@ -1375,8 +2178,29 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     gather(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type(), root);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type(), root);
+  }
+  template <packable_container sent_type, packable_container received_type>
+  void                                      gather                        (const sent_type&     sent    , 
+                                                                                 received_type& received, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    // The processes may pack differing numbers of elements, hence the sizes are gathered first.
+    const container_packer<sent_type> sent_packer(sent);
+    const count                       sent_size  (static_cast<count>(sent_packer.size()));
+    std::vector<count>                sizes      (rank() == root ? static_cast<std::size_t>(size()) : 0);
+    gather(&sent_size, 1, type_traits<count>::get_data_type(), sizes.data(), 1, type_traits<count>::get_data_type(), root);
+
+    std::vector<aint>                 displacements  (sizes.size());
+    std::exclusive_scan(sizes.begin(), sizes.end(), displacements.begin(), aint(0));
+    container_packer<received_type>   received_packer(static_cast<std::size_t>(std::reduce(sizes.begin(), sizes.end(), count(0))));
+    gather_varying(
+      sent_packer    .data(), sent_size, sent_packer    .data_type(), 
+      received_packer.data(), sizes, displacements, received_packer.data_type(), root);
+
+    if (rank() == root)
+      received_packer.unpack(received);
   }
   template <typename type>                            
   void                                      gather                        (      type&          data    , 
@@ -1385,15 +2209,21 @@ public:
     using adapter = container_adapter<type>;
     gather(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), root);
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), root);
   }
   [[nodiscard]]                                                           
-  request                                   immediate_gather              (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t               received_size ,                                                 const data_type& received_data_type,  
+  request                                   immediate_gather              (const void*          sent    , const count                      sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const count                      received_size ,                                                 const data_type& received_data_type,  
                                                                            const std::int32_t   root = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Igather, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Igather_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, &result.native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Igather  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), root, native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -1404,8 +2234,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return immediate_gather(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type(), root);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type(), root);
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_gather              (type&                data    , 
@@ -1414,16 +2244,16 @@ public:
     using adapter = container_adapter<type>;
     return immediate_gather(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), root);
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), root);
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]                                                           
-  request                                   persistent_gather             (const void*          sent    , const std::int32_t      sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t      received_size, const data_type& received_data_type,  
+  request                                   persistent_gather             (const void*          sent    , const count             sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const count             received_size, const data_type& received_data_type,  
                                                                            const std::int32_t   root = 0, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Gather_init, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Gather_init_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -1434,8 +2264,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return persistent_gather(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received) / size()), receive_adapter::data_type(), root, info);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent)             ), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received) / size()), receive_adapter::data_type(), root, info);
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_gather             (      type&          data    , 
@@ -1444,19 +2274,25 @@ public:
     using adapter = container_adapter<type>;
     return persistent_gather(
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL),
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), root, info);
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), root, info);
   }
 #endif
 
   void                                      gather_varying                (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
     MPI_CHECK_ERROR_CODE(MPI_Gatherv, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), root, native_))
   }
+  void                                      gather_varying                (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    gather_varying(sent, sent_size, sent_data_type, received, std::span(received_sizes), std::span(displacements), received_data_type, root);
+  }
   template <typename sent_type, typename received_type>
   void                                      gather_varying                (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1471,7 +2307,14 @@ public:
   }
   template <typename sent_type, typename received_type>
   void                                      gather_varying                (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes,
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    gather_varying(sent, received, std::span(received_sizes), std::span(displacements), root, resize);
+  }
+  template <typename sent_type, typename received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes,
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     std::vector<std::int32_t> displacements(received_sizes.size());
@@ -1479,7 +2322,14 @@ public:
 
     gather_varying(sent, received, received_sizes, displacements, root, resize);
   }
-  template <typename sent_type, typename received_type>                            
+  template <typename sent_type, typename received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes,
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    gather_varying(sent, received, std::span(received_sizes), root, resize);
+  }
+  template <typename sent_type, typename received_type> requires (!nested_container<received_type>)
   void                                      gather_varying                (const sent_type&     sent    , 
                                                                                  received_type& received,
                                                                            const std::int32_t   root = 0, const bool resize = false) const
@@ -1490,8 +2340,56 @@ public:
 
     gather_varying(sent, received, received_sizes, root, resize);
   }
+  template <typename sent_type, typename received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes,
+                                                                           collective_workspace& workspace, const std::int32_t root = 0, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    std::exclusive_scan(received_sizes.begin(), received_sizes.end(), workspace.received_displacements().begin(), 0);
+
+    gather_varying(sent, received, received_sizes, workspace.received_displacements(), root, resize);
+  }
+  template <typename sent_type, typename received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received,
+                                                                           collective_workspace& workspace, const std::int32_t root = 0, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    const auto local_size = static_cast<std::int32_t>(container_adapter<sent_type>::size(sent));
+    gather(&local_size, 1, type_traits<std::int32_t>::get_data_type(), workspace.received_sizes().data(), 1, type_traits<std::int32_t>::get_data_type(), root);
+
+    gather_varying(sent, received, workspace.received_sizes(), workspace, root, resize);
+  }
+  // Nested containers are always resized, as the lengths of the inner containers are only known to the sender.
+  template <nested_container sent_type, nested_container received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received,
+                                                                           const std::int32_t   root = 0) const
+  {
+    const nested_sender<sent_type> sender       (sent);
+    const count                    local_sizes[] {sender.size(), sender.element_count(0, sent.size())};
+    std::vector<count>             sizes        (rank() == root ? 2 * size() : 0);
+    gather(local_sizes, 2, type_traits<count>::get_data_type(), sizes.data(), 2, type_traits<count>::get_data_type(), root);
+
+    nested_receiver<received_type> receiver           (sizes);
+    const auto                     sent_data_type     (sender.data_type(0, sent.size()));
+    std::vector<const data_type*>  sent_data_types    (size(), nullptr);
+    std::vector<data_type>         received_data_types;
+    sent_data_types[root] = &sent_data_type;
+    if (rank() == root)
+    {
+      received_data_types.reserve(size());
+      for (std::int32_t i = 0; i < size(); ++i)
+        received_data_types.push_back(receiver.data_type(i));
+    }
+
+    all_to_all_addressed(sent_data_types, rank() == root ? addresses(received_data_types) : std::vector<const data_type*>(size(), nullptr));
+    if (rank() == root)
+      receiver.unpack(received);
+  }
   template <typename type>                            
-  void                                      gather_varying                (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+  void                                      gather_varying                (      type&          data    , std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0) const
   {
     using adapter = container_adapter<type>;
@@ -1499,7 +2397,13 @@ public:
     gather_varying(MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), adapter::data(data), received_sizes, displacements, adapter::data_type(), root);
   }
   template <typename type>                            
-  void                                      gather_varying                (      type&          data    , const std::vector<std::int32_t>& received_sizes,                                                 
+  void                                      gather_varying                (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    gather_varying(data, std::span(received_sizes), std::span(displacements), root);
+  }
+  template <typename type>                            
+  void                                      gather_varying                (      type&          data    , std::span<const std::int32_t>    received_sizes,                                                 
                                                                            const std::int32_t   root = 0) const
   {
     std::vector<std::int32_t> displacements(received_sizes.size());
@@ -1508,6 +2412,12 @@ public:
     gather_varying(data, received_sizes, displacements, root);
   }
   template <typename type>                            
+  void                                      gather_varying                (      type&          data    , const std::vector<std::int32_t>& received_sizes,                                                 
+                                                                           const std::int32_t   root = 0) const
+  {
+    gather_varying(data, std::span(received_sizes), root);
+  }
+  template <typename type>                            
   void                                      gather_varying                (      type&          data    , 
                                                                            const std::int32_t   root = 0) const
   {
@@ -1517,18 +2427,36 @@ public:
 
     gather_varying(data, received_sizes, root);
   }
-  [[nodiscard]]
-  request                                   immediate_gather_varying      (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+  void                                      gather_varying                (const void*          sent    , const count                      sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         displacements, const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
-    request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Igatherv, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), root, native_, &result.native_))
-    return  result;
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Gatherv_c, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), root, native_))
+#else
+    const auto         local_rank        = static_cast<std::size_t>(rank());
+    const auto         communicator_size = static_cast<std::size_t>(size());
+    std::vector<count> sent_sizes        (communicator_size, 0);
+    std::vector<aint>  sent_displacements(communicator_size, 0);
+    std::vector<count> gathered_sizes    (communicator_size, 0);
+    std::vector<aint>  gathered_displacements(communicator_size, 0);
+
+    if (rank() == root)
+    {
+      gathered_sizes         = received_sizes;
+      gathered_displacements = displacements ;
+    }
+    if (sent == MPI_IN_PLACE)
+      gathered_sizes[local_rank] = 0;
+    else
+      sent_sizes[root] = sent_size;
+
+    all_to_all_varying_large(sent == MPI_IN_PLACE ? nullptr : sent, sent_sizes, sent_displacements, sent_data_type, received, gathered_sizes, gathered_displacements, received_data_type);
+#endif
   }
-  template <typename sent_type, typename received_type> [[nodiscard]]                           
-  request                                   immediate_gather_varying      (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+  template <typename sent_type, typename received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<count>&        received_sizes, const std::vector<aint>&         displacements, 
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1537,31 +2465,103 @@ public:
     if (resize && rank() == root)
       receive_adapter::resize(received, std::reduce(received_sizes.begin(), received_sizes.end()));
 
-    return immediate_gather_varying(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter   ::data_type(), 
-      receive_adapter::data(received), received_sizes, displacements                      , receive_adapter::data_type(), root);
+    gather_varying(
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter::size(sent)), send_adapter   ::data_type(), 
+      receive_adapter::data(received), received_sizes, displacements               , receive_adapter::data_type(), root);
   }
-  template <typename type> [[nodiscard]]                           
-  request                                   immediate_gather_varying      (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
-                                                                           const std::int32_t   root = 0) const
+  template <typename sent_type, typename received_type>
+  void                                      gather_varying                (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<count>&        received_sizes,
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    std::vector<aint> displacements(received_sizes.size());
+    std::exclusive_scan(received_sizes.begin(), received_sizes.end(), displacements.begin(), aint(0));
+
+    gather_varying(sent, received, received_sizes, displacements, root, resize);
+  }
+  [[nodiscard]]
+  request                                   immediate_gather_varying      (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    request result(MPI_REQUEST_NULL, true);
+    MPI_CHECK_ERROR_CODE(MPI_Igatherv, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), root, native_, &result.native_))
+    return  result;
+  }
+  [[nodiscard]]
+  request                                   immediate_gather_varying      (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    return immediate_gather_varying(sent, sent_size, sent_data_type, received, std::span(received_sizes), std::span(displacements), received_data_type, root);
+  }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   immediate_gather_varying      (const sent_type&     sent    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+
+    if (resize && rank() == root)
+      receive_adapter::resize(received, std::reduce(received_sizes.begin(), received_sizes.end()));
+
+    return immediate_gather_varying(
+      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter   ::data_type(), 
+      receive_adapter::data(received), received_sizes, displacements                      , receive_adapter::data_type(), root);
+  }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   immediate_gather_varying      (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    return immediate_gather_varying(sent, received, std::span(received_sizes), std::span(displacements), root, resize);
+  }
+  template <typename type> [[nodiscard]]                           
+  request                                   immediate_gather_varying      (      type&          data    , std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, 
+                                                                           const std::int32_t   root = 0) const
   {
     using adapter = container_adapter<type>;
     
     return immediate_gather_varying(MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), adapter::data(data), received_sizes, displacements, adapter::data_type(), root);
   }
+  template <typename type> [[nodiscard]]                           
+  request                                   immediate_gather_varying      (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    return immediate_gather_varying(data, std::span(received_sizes), std::span(displacements), root);
+  }
+#ifdef MPI_GEQ_4_0
+  [[nodiscard]]
+  request                                   immediate_gather_varying      (const void*          sent    , const count                      sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         displacements, const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    request result(MPI_REQUEST_NULL, true);
+    MPI_CHECK_ERROR_CODE(MPI_Igatherv_c, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), root, native_, &result.native_))
+    return result;
+  }
+#endif
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
   request                                   persistent_gather_varying     (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                                 void*          received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements, const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
     MPI_CHECK_ERROR_CODE(MPI_Gatherv_init, (sent, sent_size, sent_data_type.native(), received, received_sizes.data(), displacements.data(), received_data_type.native(), root, native_, info.native(), &result.native_))
     return  result;
   }
+  [[nodiscard]]
+  request                                   persistent_gather_varying     (const void*          sent    , const std::int32_t               sent_size     ,                                                 const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements, const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0, const mpi::information& info = mpi::information()) const
+  {
+    return persistent_gather_varying(sent, sent_size, sent_data_type, received, std::span(received_sizes), std::span(displacements), received_data_type, root, info);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                           
   request                                   persistent_gather_varying     (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements,
+                                                                                 received_type& received, std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements,
                                                                            const std::int32_t   root = 0, const mpi::information& info = mpi::information(), const bool resize = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1574,56 +2574,107 @@ public:
       send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter   ::data_type(), 
       receive_adapter::data(received), received_sizes, displacements                      , receive_adapter::data_type(), root, info);
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                           
+  request                                   persistent_gather_varying     (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements,
+                                                                           const std::int32_t   root = 0, const mpi::information& info = mpi::information(), const bool resize = false) const
+  {
+    return persistent_gather_varying(sent, received, std::span(received_sizes), std::span(displacements), root, info, resize);
+  }
   template <typename type> [[nodiscard]]                           
-  request                                   persistent_gather_varying     (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements,
+  request                                   persistent_gather_varying     (      type&          data    , std::span<const std::int32_t>    received_sizes, std::span<const std::int32_t>    displacements,
                                                                            const std::int32_t   root = 0, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
     
     return persistent_gather_varying(MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), adapter::data(data), received_sizes, displacements, adapter::data_type(), root, info);
   }
+  template <typename type> [[nodiscard]]                           
+  request                                   persistent_gather_varying     (      type&          data    , const std::vector<std::int32_t>& received_sizes, const std::vector<std::int32_t>& displacements,
+                                                                           const std::int32_t   root = 0, const mpi::information& info = mpi::information()) const
+  {
+    return persistent_gather_varying(data, std::span(received_sizes), std::span(displacements), root, info);
+  }
 #endif
 
-  void                                      reduce_local                  (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum) const
+  void                                      reduce_local                  (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Reduce_local, (sent, received, size, data_type.native(), op.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_local_c, (sent, received, size, data_type.native(), op.native()))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_local  , (sent, received, large.size(), large.data_type(), large.op()))
+#endif
   }
   template <typename sent_type, typename received_type>
   void                                      reduce_local                  (const sent_type& sent, received_type& received,                                                      const op& op = ops::sum) const
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    reduce_local(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    reduce_local(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type>                            
   void                                      reduce_local                  (      type&      data,                                                                               const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    reduce_local(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    reduce_local(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
   
-  void                                      reduce                        (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum, const std::int32_t root = 0) const
+  void                                      reduce                        (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum, const std::int32_t root = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Reduce, (sent, received, size, data_type.native(), op.native(), root, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_c, (sent, received, size, data_type.native(), op.native(), root, native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Reduce  , (sent, received, large.size(), large.data_type(), large.op(), root, native_))
+#endif
   }
   template <typename sent_type, typename received_type>
   void                                      reduce                        (const sent_type& sent, received_type& received,                                                      const op& op = ops::sum, const std::int32_t root = 0) const
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op, root);
+    reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), root);
   }
   template <typename type>                            
   void                                      reduce                        (      type&      data,                                                                               const op& op = ops::sum, const std::int32_t root = 0) const
   {
     using adapter = container_adapter<type>;
-    reduce(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, root);
+    reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), root);
+  }
+  // Sums independent of the number of processes and the reduction order, at the cost of exchanging exact accumulators (see exact_accumulator.hpp).
+  template <std::floating_point type>
+  void                                      reproducible_reduce           (const type*      sent, type*          received, const count        size,                                      const std::int32_t root = 0) const
+  {
+    const auto is_root = rank() == root;
+    reduce_exactly(sent, received, size, is_root, [&] (std::int64_t* limbs, const count limb_count)
+    {
+      reduce(is_root ? MPI_IN_PLACE : limbs, is_root ? limbs : nullptr, limb_count, type_traits<std::int64_t>::get_data_type(), ops::sum, root);
+    });
+  }
+  template <typename sent_type, typename received_type> requires std::floating_point<typename container_adapter<sent_type>::value_type>
+  void                                      reproducible_reduce           (const sent_type& sent, received_type& received,                                                                           const std::int32_t root = 0) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+    reproducible_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), root);
+  }
+  template <typename type> requires std::floating_point<typename container_adapter<type>::value_type>
+  void                                      reproducible_reduce           (      type&      data,                                                                                                  const std::int32_t root = 0) const
+  {
+    using adapter = container_adapter<type>;
+    reproducible_reduce(adapter::data(data), adapter::data(data), static_cast<count>(adapter::size(data)), root);
   }
   [[nodiscard]]
-  request                                   immediate_reduce              (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum, const std::int32_t root = 0) const
+  request                                   immediate_reduce              (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum, const std::int32_t root = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Ireduce, (sent, received, size, data_type.native(), op.native(), root, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ireduce_c, (sent, received, size, data_type.native(), op.native(), root, native_, &result.native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Ireduce  , (sent, received, large.size(), large.data_type(), large.op(), root, native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1631,20 +2682,20 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return immediate_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op, root);
+    return immediate_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), root);
   }
   template <typename type> [[nodiscard]]                           
   request                                   immediate_reduce              (      type&      data,                                                                               const op& op = ops::sum, const std::int32_t root = 0) const
   {
     using adapter = container_adapter<type>;
-    return immediate_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, root);
+    return immediate_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), root);
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   persistent_reduce             (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum, const std::int32_t root = 0, const mpi::information& info = mpi::information()) const
+  request                                   persistent_reduce             (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum, const std::int32_t root = 0, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Reduce_init, (sent, received, size, data_type.native(), op.native(), root, native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Reduce_init_c, (sent, received, size, data_type.native(), op.native(), root, native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1652,62 +2703,116 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return persistent_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op, root, info);
+    return persistent_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), root, info);
   }
   template <typename type> [[nodiscard]]                           
   request                                   persistent_reduce             (      type&      data,                                                                               const op& op = ops::sum, const std::int32_t root = 0, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, root, info);
+    return persistent_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), root, info);
   }
 #endif
   
   // One to all collective operations.
                                 
-  void                                      broadcast                     (void* data, const std::int32_t count, const data_type& data_type, const std::int32_t root = 0) const
+  void                                      broadcast                     (void* data, const count        size , const data_type& data_type, const std::int32_t root = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Bcast, (data, count, data_type.native(), root, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Bcast_c, (data, size, data_type.native(), root, native_))
+#else
+    if (is_large_count(size))
+      pipelined_broadcast(data, size, data_type, root);
+    else
+      MPI_CHECK_ERROR_CODE(MPI_Bcast  , (data, static_cast<std::int32_t>(size), data_type.native(), root, native_))
+#endif
   }
   template <typename type>                                                
   void                                      broadcast                     (type& data,                                                       const std::int32_t root = 0) const
   {
     using adapter = container_adapter<type>;
-    broadcast(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), root);
+    broadcast(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), root);
+  }
+  template <packable_container type>
+  void                                      broadcast                     (type& data,                                                       const std::int32_t root = 0) const
+  {
+    // The receiving processes can not infer the number of elements from their containers, hence it is broadcast first.
+    auto element_count = static_cast<count>(std::distance(data.begin(), data.end()));
+    broadcast(element_count, root);
+
+    if (rank() == root)
+    {
+      container_packer<type> packer(data);
+      broadcast(packer.data(), element_count, packer.data_type(), root);
+    }
+    else
+    {
+      container_packer<type> packer(static_cast<std::size_t>(element_count));
+      broadcast(packer.data(), element_count, packer.data_type(), root);
+      packer.unpack(data);
+    }
   }
   [[nodiscard]]                                                           
-  request                                   immediate_broadcast           (void* data, const std::int32_t count, const data_type& data_type, const std::int32_t root = 0) const
+  request                                   immediate_broadcast           (void* data, const count        size , const data_type& data_type, const std::int32_t root = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Ibcast, (data, count, data_type.native(), root, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Ibcast_c, (data, size, data_type.native(), root, native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Ibcast  , (data, large.size(), large.data_type(), root, native_, &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_broadcast           (type& data,                                                       const std::int32_t root = 0) const
   {
     using adapter = container_adapter<type>;
-    return immediate_broadcast(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), root);
+    return immediate_broadcast(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), root);
+  }
+  void                                      pipelined_broadcast           (void* data, const count        size , const data_type& data_type, const std::int32_t root = 0, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    if (size <= policy.threshold)
+      return broadcast(data, size, data_type, root);
+
+    const auto extent = data_type.extent()[1];
+    pipeline(size, policy, [&] (const count offset, const std::int32_t segment_size)
+    {
+      return immediate_broadcast(static_cast<std::byte*>(data) + offset * extent, segment_size, data_type, root);
+    });
+  }
+  template <typename type>                                                
+  void                                      pipelined_broadcast           (type& data,                                                       const std::int32_t root = 0, const pipeline_policy& policy = pipeline_policy()) const
+  {
+    using adapter = container_adapter<type>;
+    pipelined_broadcast(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), root, policy);
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]                                                           
-  request                                   persistent_broadcast          (void* data, const std::int32_t count, const data_type& data_type, const std::int32_t root = 0, const mpi::information& info = mpi::information()) const
+  request                                   persistent_broadcast          (void* data, const count        size , const data_type& data_type, const std::int32_t root = 0, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Bcast_init, (data, count, data_type.native(), root, native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Bcast_init_c, (data, size, data_type.native(), root, native_, info.native(), &result.native_))
     return result;
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_broadcast          (type& data,                                                       const std::int32_t root = 0, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_broadcast(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), root, info);
+    return persistent_broadcast(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), root, info);
   }
 #endif
 
-  void                                      scatter                       (const void*          sent    , const std::int32_t sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t received_size, const data_type& received_data_type, 
+  void                                      scatter                       (const void*          sent    , const count        sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const count        received_size, const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Scatter, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Scatter_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Scatter  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), root, native_))
+#endif
   }
   template <typename sent_type, typename received_type>                            
   void                                      scatter                       (const sent_type&     sent    , 
@@ -1717,8 +2822,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     scatter(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)         ), receive_adapter::data_type(), root);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)         ), receive_adapter::data_type(), root);
   }
   template <typename type>                            
   void                                      scatter                       (      type&          data    , 
@@ -1726,16 +2831,22 @@ public:
   {
     using adapter = container_adapter<type>;
     scatter(
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(),
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(),
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), root);
   }
   [[nodiscard]]                                                           
-  request                                   immediate_scatter             (const void*          sent    , const std::int32_t sent_size    , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t received_size, const data_type& received_data_type, 
+  request                                   immediate_scatter             (const void*          sent    , const count        sent_size    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const count        received_size, const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Iscatter, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Iscatter_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, &result.native_))
+#else
+    const large_count sent_large    (sent_size    , sent_data_type    );
+    const large_count received_large(received_size, received_data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Iscatter  , (sent, sent_large.size()    , sent_large.data_type()    , received, received_large.size(), received_large.data_type(), root, native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -1746,8 +2857,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return immediate_scatter(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)         ), receive_adapter::data_type(), root);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)         ), receive_adapter::data_type(), root);
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   immediate_scatter             (      type&          data    , 
@@ -1755,17 +2866,17 @@ public:
   {
     using adapter = container_adapter<type>;
     return immediate_scatter(
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), 
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), 
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), root);
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]                                                           
-  request                                   persistent_scatter            (const void*          sent    , const std::int32_t      sent_size     , const data_type& sent_data_type    ,
-                                                                                 void*          received, const std::int32_t      received_size , const data_type& received_data_type, 
+  request                                   persistent_scatter            (const void*          sent    , const count             sent_size     , const data_type& sent_data_type    ,
+                                                                                 void*          received, const count             received_size , const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0, const mpi::information& info          = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Scatter_init, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Scatter_init_c, (sent, sent_size, sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
@@ -1776,8 +2887,8 @@ public:
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
     return persistent_scatter(
-      send_adapter   ::data(sent    ), static_cast<std::int32_t>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
-      receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)         ), receive_adapter::data_type(), root, info);
+      send_adapter   ::data(sent    ), static_cast<count>(send_adapter   ::size(sent    ) / size()), send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)         ), receive_adapter::data_type(), root, info);
   }
   template <typename type> [[nodiscard]]                                                           
   request                                   persistent_scatter            (      type&          data    , 
@@ -1785,20 +2896,26 @@ public:
   {
     using adapter = container_adapter<type>;
     return persistent_scatter(
-      adapter::data(data), static_cast<std::int32_t>(adapter::size(data) / size()), adapter::data_type(), 
+      adapter::data(data), static_cast<count>(adapter::size(data) / size()), adapter::data_type(), 
       MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), root, info);
   }
 #endif
 
-  void                                      scatter_varying               (const void*          sent    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, const data_type& sent_data_type    ,
+  void                                      scatter_varying               (const void*          sent    , std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, const data_type& sent_data_type    ,
                                                                                  void*          received, const std::int32_t               received_size,                                                 const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
     MPI_CHECK_ERROR_CODE(MPI_Scatterv, (sent, sent_sizes.data(), displacements.data(), sent_data_type.native(), received, received_size, received_data_type.native(), root, native_))
   }
+  void                                      scatter_varying               (const void*          sent    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::int32_t               received_size,                                                 const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    scatter_varying(sent, std::span(sent_sizes), std::span(displacements), sent_data_type, received, received_size, received_data_type, root);
+  }
   template <typename sent_type, typename received_type>                            
   void                                      scatter_varying               (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1815,9 +2932,16 @@ public:
       send_adapter   ::data(sent    ), sent_sizes, displacements                                 , send_adapter   ::data_type(), 
       receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), receive_adapter::data_type(), root);
   }
+  template <typename sent_type, typename received_type>                            
+  void                                      scatter_varying               (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    scatter_varying(sent, received, std::span(sent_sizes), std::span(displacements), root, resize);
+  }
   template <typename sent_type, typename received_type>                                                                                                                                                                          
   void                                      scatter_varying               (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , 
+                                                                                 received_type& received, std::span<const std::int32_t>    sent_sizes   , 
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     std::vector<std::int32_t> displacements(sent_sizes.size());
@@ -1825,8 +2949,25 @@ public:
 
     scatter_varying(sent, received, sent_sizes, displacements, root, resize);
   }
+  template <typename sent_type, typename received_type>                                                                                                                                                                          
+  void                                      scatter_varying               (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    scatter_varying(sent, received, std::span(sent_sizes), root, resize);
+  }
+  template <typename sent_type, typename received_type>                                                                                                                                                                          
+  void                                      scatter_varying               (const sent_type&     sent    , 
+                                                                                 received_type& received, std::span<const std::int32_t>    sent_sizes   , 
+                                                                           collective_workspace& workspace, const std::int32_t root = 0, const bool resize = false) const
+  {
+    workspace.resize(static_cast<std::size_t>(size()));
+    std::exclusive_scan(sent_sizes.begin(), sent_sizes.end(), workspace.sent_displacements().begin(), 0);
+
+    scatter_varying(sent, received, sent_sizes, workspace.sent_displacements(), root, resize);
+  }
   template <typename type>                                                                                                                                                                                                       
-  void                                      scatter_varying               (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+  void                                      scatter_varying               (      type&          data    , std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     using adapter = container_adapter<type>;
@@ -1842,7 +2983,13 @@ public:
     scatter_varying(adapter::data(data), sent_sizes, displacements, adapter::data_type(), MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), root);
   }
   template <typename type>                                                                                                                                                                                                       
-  void                                      scatter_varying               (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , 
+  void                                      scatter_varying               (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    scatter_varying(data, std::span(sent_sizes), std::span(displacements), root, resize);
+  }
+  template <typename type>                                                                                                                                                                                                       
+  void                                      scatter_varying               (      type&          data    , std::span<const std::int32_t>    sent_sizes   , 
                                                                            const std::int32_t   root = 0, const bool resize = false) const
   {
     std::vector<std::int32_t> displacements(sent_sizes.size());
@@ -1850,8 +2997,70 @@ public:
 
     scatter_varying(data, sent_sizes, displacements, root, resize);
   }
+  template <typename type>                                                                                                                                                                                                       
+  void                                      scatter_varying               (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    scatter_varying(data, std::span(sent_sizes), root, resize);
+  }
+  void                                      scatter_varying               (const void*          sent    , const std::vector<count>&        sent_sizes   , const std::vector<aint>&         displacements, const data_type& sent_data_type    ,
+                                                                                 void*          received, const count                      received_size,                                                 const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Scatterv_c, (sent, sent_sizes.data(), displacements.data(), sent_data_type.native(), received, received_size, received_data_type.native(), root, native_))
+#else
+    const auto         local_rank        = static_cast<std::size_t>(rank());
+    const auto         communicator_size = static_cast<std::size_t>(size());
+    std::vector<count> scattered_sizes        (communicator_size, 0);
+    std::vector<aint>  scattered_displacements(communicator_size, 0);
+    std::vector<count> received_sizes         (communicator_size, 0);
+    std::vector<aint>  received_displacements (communicator_size, 0);
+
+    if (rank() == root)
+    {
+      scattered_sizes         = sent_sizes   ;
+      scattered_displacements = displacements;
+    }
+    if (received == MPI_IN_PLACE)
+      scattered_sizes[local_rank] = 0;
+    else
+      received_sizes[root] = received_size;
+
+    all_to_all_varying_large(sent, scattered_sizes, scattered_displacements, sent_data_type, received == MPI_IN_PLACE ? nullptr : received, received_sizes, received_displacements, received_data_type);
+#endif
+  }
+  template <typename sent_type, typename received_type>                            
+  void                                      scatter_varying               (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<count>&        sent_sizes   , const std::vector<aint>&         displacements, 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+    
+    if (resize)
+    {
+      count local_size(0);
+      scatter(sent_sizes, local_size, root);
+      receive_adapter::resize(received, local_size);
+    }
+
+    scatter_varying(
+      send_adapter   ::data(sent    ), sent_sizes, displacements                          , send_adapter   ::data_type(), 
+      receive_adapter::data(received), static_cast<count>(receive_adapter::size(received)), receive_adapter::data_type(), root);
+  }
+  template <typename sent_type, typename received_type>                                                                                                                                                                          
+  void                                      scatter_varying               (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<count>&        sent_sizes   , 
+                                                                           const std::int32_t   root = 0, const bool resize = false) const
+  {
+    std::vector<aint> displacements(sent_sizes.size());
+    std::exclusive_scan(sent_sizes.begin(), sent_sizes.end(), displacements.begin(), aint(0));
+
+    scatter_varying(sent, received, sent_sizes, displacements, root, resize);
+  }
   [[nodiscard]]                                                           
-  request                                   immediate_scatter_varying     (const void*          sent    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, const data_type& sent_data_type    ,
+  request                                   immediate_scatter_varying     (const void*          sent    , std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, const data_type& sent_data_type    ,
                                                                                  void*          received, const std::int32_t               received_size,                                                 const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0) const
   {
@@ -1859,9 +3068,16 @@ public:
     MPI_CHECK_ERROR_CODE(MPI_Iscatterv, (sent, sent_sizes.data(), displacements.data(), sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, &result.native_))
     return  result;
   }
+  [[nodiscard]]                                                           
+  request                                   immediate_scatter_varying     (const void*          sent    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::int32_t               received_size,                                                 const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    return immediate_scatter_varying(sent, std::span(sent_sizes), std::span(displacements), sent_data_type, received, received_size, received_data_type, root);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
   request                                   immediate_scatter_varying     (const sent_type&     sent, 
-                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1870,16 +3086,40 @@ public:
       send_adapter   ::data(sent    ), sent_sizes, displacements                                 , send_adapter   ::data_type(), 
       receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), receive_adapter::data_type(), root);
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                                                           
+  request                                   immediate_scatter_varying     (const sent_type&     sent, 
+                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    return immediate_scatter_varying(sent, received, std::span(sent_sizes), std::span(displacements), root);
+  }
   template <typename type> [[nodiscard]]                                                           
-  request                                   immediate_scatter_varying     (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+  request                                   immediate_scatter_varying     (      type&          data    , std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0) const
   {
     using adapter = container_adapter<type>;
     return immediate_scatter_varying(adapter::data(data), sent_sizes, displacements, adapter::data_type(), MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), root);
   }
+  template <typename type> [[nodiscard]]                                                           
+  request                                   immediate_scatter_varying     (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    return immediate_scatter_varying(data, std::span(sent_sizes), std::span(displacements), root);
+  }
+#ifdef MPI_GEQ_4_0
+  [[nodiscard]]
+  request                                   immediate_scatter_varying     (const void*          sent    , const std::vector<count>&        sent_sizes   , const std::vector<aint>&         displacements, const data_type& sent_data_type    ,
+                                                                                 void*          received, const count                      received_size,                                                 const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0) const
+  {
+    request result(MPI_REQUEST_NULL, true);
+    MPI_CHECK_ERROR_CODE(MPI_Iscatterv_c, (sent, sent_sizes.data(), displacements.data(), sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, &result.native_))
+    return result;
+  }
+#endif
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]                                                           
-  request                                   persistent_scatter_varying    (const void*          sent    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, const data_type& sent_data_type    ,
+  request                                   persistent_scatter_varying    (const void*          sent    , std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, const data_type& sent_data_type    ,
                                                                                  void*          received, const std::int32_t               received_size,                                                 const data_type& received_data_type, 
                                                                            const std::int32_t   root = 0, const mpi::information&          info = mpi::information()) const
   {
@@ -1887,9 +3127,16 @@ public:
     MPI_CHECK_ERROR_CODE(MPI_Scatterv_init, (sent, sent_sizes.data(), displacements.data(), sent_data_type.native(), received, received_size, received_data_type.native(), root, native_, info.native(), &result.native_))
     return  result;
   }
+  [[nodiscard]]                                                           
+  request                                   persistent_scatter_varying    (const void*          sent    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::int32_t               received_size,                                                 const data_type& received_data_type, 
+                                                                           const std::int32_t   root = 0, const mpi::information&          info = mpi::information()) const
+  {
+    return persistent_scatter_varying(sent, std::span(sent_sizes), std::span(displacements), sent_data_type, received, received_size, received_data_type, root, info);
+  }
   template <typename sent_type, typename received_type> [[nodiscard]]                                                           
   request                                   persistent_scatter_varying    (const sent_type&     sent    , 
-                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                                 received_type& received, std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0, const mpi::information&          info = mpi::information()) const
   {
     using send_adapter    = container_adapter<sent_type>;
@@ -1898,39 +3145,62 @@ public:
       send_adapter   ::data(sent    ), sent_sizes, displacements                                 , send_adapter   ::data_type(), 
       receive_adapter::data(received), static_cast<std::int32_t>(receive_adapter::size(received)), receive_adapter::data_type(), root, info);
   }
+  template <typename sent_type, typename received_type> [[nodiscard]]                                                           
+  request                                   persistent_scatter_varying    (const sent_type&     sent    , 
+                                                                                 received_type& received, const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0, const mpi::information&          info = mpi::information()) const
+  {
+    return persistent_scatter_varying(sent, received, std::span(sent_sizes), std::span(displacements), root, info);
+  }
   template <typename type> [[nodiscard]]                                                           
-  request                                   persistent_scatter_varying    (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+  request                                   persistent_scatter_varying    (      type&          data    , std::span<const std::int32_t>    sent_sizes   , std::span<const std::int32_t>    displacements, 
                                                                            const std::int32_t   root = 0, const mpi::information&          info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
     return persistent_scatter_varying(adapter::data(data), sent_sizes, displacements, adapter::data_type(), MPI_IN_PLACE, 0, data_type(MPI_DATATYPE_NULL), root, info);
   }
+  template <typename type> [[nodiscard]]                                                           
+  request                                   persistent_scatter_varying    (      type&          data    , const std::vector<std::int32_t>& sent_sizes   , const std::vector<std::int32_t>& displacements, 
+                                                                           const std::int32_t   root = 0, const mpi::information&          info = mpi::information()) const
+  {
+    return persistent_scatter_varying(data, std::span(sent_sizes), std::span(displacements), root, info);
+  }
 #endif
 
   // Other collective operations.
 
-  void                                      inclusive_scan                (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum) const
+  void                                      inclusive_scan                (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Scan, (sent, received, size, data_type.native(), op.native(), native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Scan_c, (sent, received, size, data_type.native(), op.native(), native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Scan  , (sent, received, large.size(), large.data_type(), large.op(), native_))
+#endif
   }
   template <typename sent_type, typename received_type>
   void                                      inclusive_scan                (const sent_type& sent, received_type& received,                                                      const op& op = ops::sum) const
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    inclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    inclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type>                            
   void                                      inclusive_scan                (      type&      data,                                                                               const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    inclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    inclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
   [[nodiscard]]
-  request                                   immediate_inclusive_scan      (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum) const
+  request                                   immediate_inclusive_scan      (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Iscan, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Iscan_c, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Iscan  , (sent, received, large.size(), large.data_type(), large.op(), native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1938,20 +3208,20 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return immediate_inclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    return immediate_inclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type> [[nodiscard]]
   request                                   immediate_inclusive_scan      (      type&      data,                                                                               const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    return immediate_inclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    return immediate_inclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   persistent_inclusive_scan     (const  void*     sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
+  request                                   persistent_inclusive_scan     (const  void*     sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Scan_init, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Scan_init_c, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1959,38 +3229,48 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return persistent_inclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op, info);
+    return persistent_inclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), info);
   }
   template <typename type> [[nodiscard]]
   request                                   persistent_inclusive_scan     (      type&      data,                                                                               const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_inclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, info);
+    return persistent_inclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), info);
   }
 #endif
 
-  void                                      exclusive_scan                (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum) const
+  void                                      exclusive_scan                (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_Exscan, (sent, received, size, data_type.native(), op.native(), native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Exscan_c, (sent, received, size, data_type.native(), op.native(), native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Exscan  , (sent, received, large.size(), large.data_type(), large.op(), native_))
+#endif
   }
   template <typename sent_type, typename received_type>
   void                                      exclusive_scan                (const sent_type& sent, received_type& received,                                                      const op& op = ops::sum) const
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    exclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    exclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type>                            
   void                                      exclusive_scan                (      type&      data,                                                                               const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    exclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    exclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
   [[nodiscard]]
-  request                                   immediate_exclusive_scan      (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum) const
+  request                                   immediate_exclusive_scan      (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Iexscan, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Iexscan_c, (sent, received, size, data_type.native(), op.native(), native_, &result.native_))
+#else
+    const large_count large(size, data_type, op);
+    MPI_CHECK_ERROR_CODE(MPI_Iexscan  , (sent, received, large.size(), large.data_type(), large.op(), native_, &result.native_))
+#endif
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -1998,20 +3278,20 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return immediate_exclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op);
+    return immediate_exclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
   }
   template <typename type> [[nodiscard]]
   request                                   immediate_exclusive_scan      (      type&      data,                                                                               const op& op = ops::sum) const
   {
     using adapter = container_adapter<type>;
-    return immediate_exclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op);
+    return immediate_exclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
   }
 #ifdef MPI_GEQ_4_0
   [[nodiscard]]
-  request                                   persistent_exclusive_scan     (const void*      sent, void*          received, const std::int32_t size, const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
+  request                                   persistent_exclusive_scan     (const void*      sent, void*          received, const count        size, const data_type& data_type, const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     request result(MPI_REQUEST_NULL, true, true);
-    MPI_CHECK_ERROR_CODE(MPI_Exscan_init, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
+    MPI_CHECK_ERROR_CODE(MPI_Exscan_init_c, (sent, received, size, data_type.native(), op.native(), native_, info.native(), &result.native_))
     return  result;
   }
   template <typename sent_type, typename received_type> [[nodiscard]]
@@ -2019,13 +3299,13 @@ public:
   {
     using send_adapter    = container_adapter<sent_type>;
     using receive_adapter = container_adapter<received_type>;
-    return persistent_exclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<std::int32_t>(send_adapter::size(sent)), send_adapter::data_type(), op, info);
+    return persistent_exclusive_scan(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op), info);
   }
   template <typename type> [[nodiscard]]
   request                                   persistent_exclusive_scan     (      type&      data,                                                                               const op& op = ops::sum, const mpi::information& info = mpi::information()) const
   {
     using adapter = container_adapter<type>;
-    return persistent_exclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type(), op, info);
+    return persistent_exclusive_scan(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op), info);
   }
 #endif
 
@@ -2041,6 +3321,177 @@ public:
   }
 
 protected:
+  tag_allocator&                            cached_tag_allocator          () const
+  {
+    return cached_attribute<tag_allocator>(native_, [&] { return tag_allocator(*attribute<std::int32_t>(communicator_key_value(MPI_TAG_UB))); });
+  }
+
+  static status                             receive_compressed            (message& message, const status& message_status, void* data, const std::size_t size, const compression_policy& policy)
+  {
+    std::vector<std::byte> buffer(static_cast<std::size_t>(message_status.count(data_types::byte)));
+    message.receive(buffer.data(), static_cast<count>(buffer.size()), data_types::byte);
+    decompress_checked(buffer, data, size, policy);
+    return message_status;
+  }
+  static void                               decompress_checked            (const std::vector<std::byte>& buffer, void* data, const std::size_t size, const compression_policy& policy)
+  {
+    const auto valid = decompressed_size(buffer) == size && decompress(buffer, static_cast<std::byte*>(data), size, policy);
+#ifdef MPI_USE_EXCEPTIONS
+    if (!valid)
+      throw exception("compressed_receive", error::truncate);
+#else
+    static_cast<void>(valid);
+#endif
+  }
+
+  // Issues the segments through the function, which returns the request of each, while keeping at most policy.depth requests in flight.
+  template <typename function_type>
+  static status                             pipeline                      (const count size, const pipeline_policy& policy, const function_type& function)
+  {
+    const auto           segment_size = std::clamp(policy.segment_size, count(1), large_count_threshold);
+    const auto           depth        = static_cast<std::size_t>(std::max(policy.depth, 1));
+
+    std::vector<request> requests;
+    std::size_t          oldest       = 0;
+    status               result;
+    for (count offset = 0; offset < size; offset += segment_size)
+    {
+      const auto segment = static_cast<std::int32_t>(std::min(segment_size, size - offset));
+      if (requests.size() < depth)
+        requests.push_back(function(offset, segment));
+      else
+      {
+        result           = requests[oldest].wait();
+        requests[oldest] = function(offset, segment);
+        oldest           = (oldest + 1) % depth;
+      }
+    }
+    for (std::size_t i = 0; i < requests.size(); ++i)
+      result = requests[(oldest + i) % requests.size()].wait();
+    return result;
+  }
+
+#ifndef MPI_GEQ_4_0
+  // Prior to MPI 4.0, the varying collectives with large counts are expressed through MPI_Alltoallw, which accepts a distinct data type per process.
+  // Blocks which do not fit into std::int32_t (or whose displacement in bytes does not) are described by a large count data type placed at the displacement.
+  void                                      all_to_all_varying_large      (const void*          sent    , const std::vector<count>&        sent_sizes    , const std::vector<aint>&         sent_displacements    , const data_type& sent_data_type    ,
+                                                                                 void*          received, const std::vector<count>&        received_sizes, const std::vector<aint>&         received_displacements, const data_type& received_data_type) const
+  {
+    std::vector<MPI_Datatype> placed_data_types;
+    const auto describe = [&] (const std::vector<count>& sizes, const std::vector<aint>& displacements, const data_type& data_type, std::vector<std::int32_t>& native_sizes, std::vector<std::int32_t>& native_displacements, std::vector<MPI_Datatype>& native_data_types)
+    {
+      aint lower_bound(0), extent(0);
+      if (data_type.native() != MPI_DATATYPE_NULL)
+        MPI_CHECK_ERROR_CODE(MPI_Type_get_extent, (data_type.native(), &lower_bound, &extent))
+
+      for (std::size_t i = 0; i < sizes.size(); ++i)
+      {
+        const aint displacement = displacements[i] * extent;
+        if      (sizes[i] == 0)
+        {
+          native_sizes        .push_back(0);
+          native_displacements.push_back(0);
+          native_data_types   .push_back(MPI_BYTE);
+        }
+        else if (!is_large_count(sizes[i]) && !is_large_count(displacement))
+        {
+          native_sizes        .push_back(static_cast<std::int32_t>(sizes[i]));
+          native_displacements.push_back(static_cast<std::int32_t>(displacement));
+          native_data_types   .push_back(data_type.native());
+        }
+        else
+        {
+          const large_count large(sizes[i], data_type);
+          std::int32_t      block_length(large.size());
+          MPI_Datatype      block_data_type(large.data_type());
+          MPI_Datatype      placed_data_type;
+          MPI_CHECK_ERROR_CODE(MPI_Type_create_struct, (1, &block_length, &displacement, &block_data_type, &placed_data_type))
+          MPI_CHECK_ERROR_CODE(MPI_Type_commit       , (&placed_data_type))
+          placed_data_types   .push_back(placed_data_type);
+
+          native_sizes        .push_back(1);
+          native_displacements.push_back(0);
+          native_data_types   .push_back(placed_data_type);
+        }
+      }
+    };
+
+    std::vector<std::int32_t> native_sent_sizes    , native_sent_displacements    , native_received_sizes    , native_received_displacements;
+    std::vector<MPI_Datatype> native_sent_data_types, native_received_data_types;
+    describe(sent_sizes    , sent_displacements    , sent_data_type    , native_sent_sizes    , native_sent_displacements    , native_sent_data_types    );
+    describe(received_sizes, received_displacements, received_data_type, native_received_sizes, native_received_displacements, native_received_data_types);
+
+    MPI_CHECK_ERROR_CODE(MPI_Alltoallw, (
+      sent    , native_sent_sizes    .data(), native_sent_displacements    .data(), native_sent_data_types    .data(), 
+      received, native_received_sizes.data(), native_received_displacements.data(), native_received_data_types.data(), native_))
+
+    for (auto& placed_data_type : placed_data_types)
+      MPI_CHECK_ERROR_CODE(MPI_Type_free, (&placed_data_type))
+  }
+#endif
+
+  // Transfers data described by data types over absolute addresses, where null data types denote that nothing is transferred from or to a process.
+  void                                      all_to_all_addressed          (const std::vector<const data_type*>& sent_data_types, const std::vector<const data_type*>& received_data_types) const
+  {
+    const auto describe = [ ] (const std::vector<const data_type*>& data_types, std::vector<std::int32_t>& sizes, std::vector<MPI_Datatype>& native_data_types)
+    {
+      for (std::size_t i = 0; i < data_types.size(); ++i)
+      {
+        sizes            [i] = data_types[i] ? 1                       : 0;
+        native_data_types[i] = data_types[i] ? data_types[i]->native() : MPI_BYTE;
+      }
+    };
+
+    std::vector<std::int32_t> sent_sizes            (size()), received_sizes            (size()), displacements(size(), 0);
+    std::vector<MPI_Datatype> native_sent_data_types(size()), native_received_data_types(size());
+    describe(sent_data_types    , sent_sizes    , native_sent_data_types    );
+    describe(received_data_types, received_sizes, native_received_data_types);
+
+    all_to_all_general(MPI_BOTTOM, sent_sizes, displacements, native_sent_data_types, MPI_BOTTOM, received_sizes, displacements, native_received_data_types);
+  }
+  static std::vector<const data_type*>      addresses                     (const std::vector<data_type>& data_types)
+  {
+    std::vector<const data_type*> result(data_types.size());
+    std::ranges::transform(data_types, result.begin(), [ ] (const auto& data_type) { return &data_type; });
+    return result;
+  }
+
+  // Exact accumulators are exchanged only over the range of limbs which the values of all processes are added to. Limbs are added without carries, hence the
+  // limbs of the sum are within the same range.
+  template <std::floating_point type, typename function_type>
+  void                                      reduce_exactly                (const type* sent, type* received, const count size, const bool assign, const function_type& function) const
+  {
+    std::array<std::int32_t, 2> range {-static_cast<std::int32_t>(exact_accumulator::limb_count), -1}; // The negated lowest and the highest limb.
+    for (count i = 0; i < size; ++i)
+      if (sent[i] != type(0))
+      {
+        const auto limb = static_cast<std::int32_t>(exact_accumulator::limb(sent[i]));
+        range[0] = std::max(range[0], -limb    );
+        range[1] = std::max(range[1],  limb + 2);
+      }
+    all_reduce(MPI_IN_PLACE, range.data(), 2, type_traits<std::int32_t>::get_data_type(), ops::maximum);
+
+    const auto lowest = static_cast<std::size_t>(-range[0]);
+    const auto width  = range[1] + range[0] + 1;
+    if (width <= 0)
+    {
+      if (assign)
+        std::fill_n(received, size, type(0));
+      return;
+    }
+
+    const auto stride = static_cast<std::size_t>(width);
+    std::vector<std::int64_t> limbs(static_cast<std::size_t>(size) * stride);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(size); ++i)
+      exact_accumulator::add(sent[i], limbs.data() + i * stride, lowest);
+
+    function(limbs.data(), static_cast<count>(limbs.size()));
+
+    if (assign)
+      for (std::size_t i = 0; i < static_cast<std::size_t>(size); ++i)
+        received[i] = static_cast<type>(exact_accumulator::value(limbs.data() + i * stride, lowest, stride));
+  }
+
   bool     managed_ = false;
   MPI_Comm native_  = MPI_COMM_NULL;
 };
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/enums/mode.hpp>
+#include <mpi/core/type/data_type.hpp>
+#include <mpi/core/utility/container_adapter.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/op.hpp>
+#include <mpi/core/standard_ops.hpp>
+#include <mpi/core/topology_descriptor.hpp>
+#include <mpi/core/window.hpp>
+
+// A hierarchical communicator splits its processes into nodes (processes sharing memory) and performs collectives in two levels: the node-local phase
+// exchanges data through a shared memory window, the inter-node phase is performed only among the node leaders (the first process of each node). Each
+// collective hence transfers one message per node rather than one per process across the network.
+//
+// The data types must be contiguous, as the node-local phase copies size * extent bytes. Non-commutative ops are applied in rank order within each node, but
+// in node order across nodes, which only coincides with rank order if the processes of each node are consecutive.
+namespace mpi
+{
+class hierarchical_communicator : public communicator
+{
+public:
+  explicit hierarchical_communicator  (const communicator& that)
+  : communicator(that), topology_(*this)
+  {
+
+  }
+  // Groups the processes by color instead. Processes of the same color must share memory.
+  hierarchical_communicator           (const communicator& that, const std::int32_t color)
+  : communicator(that), topology_(*this, color)
+  {
+
+  }
+  hierarchical_communicator           (const hierarchical_communicator&  that) = delete;
+  hierarchical_communicator           (      hierarchical_communicator&& temp) = default;
+  ~hierarchical_communicator          () noexcept(false) override
+  {
+    if (window_ && window_->native() != MPI_WIN_NULL)
+      window_->unlock_all();
+  }
+  hierarchical_communicator& operator=(const hierarchical_communicator&  that) = delete;
+  hierarchical_communicator& operator=(      hierarchical_communicator&& temp) = delete;
+
+  // Describes the nodes, node communicators and leader communicator which the collectives are performed over.
+  [[nodiscard]]
+  const topology_descriptor& descriptor() const
+  {
+    return topology_;
+  }
+
+  void                hierarchical_barrier   () const
+  {
+    topology_.node().barrier();
+    if (topology_.is_leader())
+      topology_.leaders().barrier();
+    topology_.node().barrier();
+  }
+
+  void                hierarchical_broadcast (      void* data, const count size, const data_type& data_type, const std::int32_t root = 0) const
+  {
+    const auto extent = data_type.extent()[1];
+    const auto bytes  = static_cast<std::size_t>(size * extent);
+    reserve(bytes);
+
+    if (rank() == root)
+      std::memcpy(buffer_, data, bytes);
+    synchronize();
+
+    if (topology_.is_leader() && topology_.node_count() > 1)
+      topology_.leaders().broadcast(buffer_, size, data_type, topology_.node_index(root));
+    synchronize();
+
+    if (rank() != root)
+      std::memcpy(data, buffer_, bytes);
+    synchronize();
+  }
+  template <typename type>
+  void                hierarchical_broadcast (      type& data,                                            const std::int32_t root = 0) const
+  {
+    using adapter = container_adapter<type>;
+    hierarchical_broadcast(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), root);
+  }
+
+  // Each process of a node reduces a slice of the contributions of the node, after which the leaders reduce the partial results across nodes.
+  void                hierarchical_all_reduce(const void* sent, void* received, const count size, const data_type& data_type, const op& op = ops::sum) const
+  {
+    const auto extent     = data_type.extent()[1];
+    const auto bytes      = static_cast<std::size_t>(size * extent);
+    const auto node_size  = static_cast<std::size_t>(topology_.node_size());
+    const auto node_rank  = static_cast<std::size_t>(topology_.node_rank());
+    reserve(node_size * bytes);
+
+    std::memcpy(buffer_ + node_rank * bytes, sent == MPI_IN_PLACE ? received : sent, bytes);
+    synchronize();
+
+    const auto result     = buffer_ + (node_size - 1) * bytes;
+    const auto slice_size = (size + static_cast<count>(node_size) - 1) / static_cast<count>(node_size);
+    const auto first      = std::min(size, static_cast<count>(node_rank) * slice_size);
+    const auto last       = std::min(size, first + slice_size);
+    if (first < last)
+      for (auto i = node_size - 1; i-- > 0;) // Contributions of lower ranks are applied from the left.
+        topology_.node().reduce_local(buffer_ + i * bytes + first * extent, result + first * extent, last - first, data_type, op);
+    synchronize();
+
+    if (topology_.is_leader() && topology_.node_count() > 1)
+      topology_.leaders().all_reduce(MPI_IN_PLACE, result, size, data_type, op);
+    synchronize();
+
+    std::memcpy(received, result, bytes);
+    synchronize();
+  }
+  template <typename sent_type, typename received_type>
+  void                hierarchical_all_reduce(const sent_type& sent, received_type& received,                 const op& op = ops::sum) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+    hierarchical_all_reduce(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type(), aggregate_op<typename send_adapter::value_type>(op));
+  }
+  template <typename type>
+  void                hierarchical_all_reduce(      type& data,                                               const op& op = ops::sum) const
+  {
+    using adapter = container_adapter<type>;
+    hierarchical_all_reduce(MPI_IN_PLACE, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type(), aggregate_op<typename adapter::value_type>(op));
+  }
+
+  // The blocks are gathered in node order within the shared memory window, hence the leaders exchange the blocks of their nodes in place.
+  void                hierarchical_all_gather(const void* sent, void* received, const count size, const data_type& data_type) const
+  {
+    const auto extent = data_type.extent()[1];
+    const auto bytes  = static_cast<std::size_t>(size * extent);
+    reserve(static_cast<std::size_t>(communicator::size()) * bytes);
+
+    const auto position = [&] (const std::int32_t process)
+    {
+      return static_cast<std::size_t>(topology_.node_offset(topology_.node_index(process)) + topology_.node_rank(process)) * bytes;
+    };
+
+    std::memcpy(buffer_ + position(rank()), sent == MPI_IN_PLACE ? static_cast<const std::byte*>(received) + rank() * bytes : sent, bytes);
+    synchronize();
+
+    if (topology_.is_leader() && topology_.node_count() > 1)
+    {
+      std::vector<std::int32_t> sizes(topology_.node_count()), displacements(topology_.node_count());
+      for (std::int32_t i = 0; i < topology_.node_count(); ++i)
+      {
+        sizes        [i] = static_cast<std::int32_t>(topology_.node_size  (i) * size);
+        displacements[i] = static_cast<std::int32_t>(topology_.node_offset(i) * size);
+      }
+      topology_.leaders().all_gather_varying(MPI_IN_PLACE, 0, mpi::data_type(MPI_DATATYPE_NULL), buffer_, sizes, displacements, data_type);
+    }
+    synchronize();
+
+    for (std::int32_t i = 0; i < communicator::size(); ++i)
+      std::memcpy(static_cast<std::byte*>(received) + i * bytes, buffer_ + position(i), bytes);
+    synchronize();
+  }
+  template <typename sent_type, typename received_type>
+  void                hierarchical_all_gather(const sent_type& sent, received_type& received,                 const bool resize = false) const
+  {
+    using send_adapter    = container_adapter<sent_type>;
+    using receive_adapter = container_adapter<received_type>;
+    if (resize)
+      receive_adapter::resize(received, communicator::size() * send_adapter::size(sent));
+    hierarchical_all_gather(send_adapter::data(sent), receive_adapter::data(received), static_cast<count>(send_adapter::size(sent)), send_adapter::data_type());
+  }
+
+protected:
+  // Collective over the node. Grows the shared memory window of the leader, which is accessed by all processes of the node through a passive target epoch.
+  void                reserve                (const std::size_t bytes) const
+  {
+    if (bytes <= capacity_ && window_)
+      return;
+
+    if (window_)
+      window_->unlock_all();
+
+    window_.emplace(topology_.node(), static_cast<aint>(topology_.is_leader() ? std::max(bytes, 2 * capacity_) : 0), 1, true);
+    window_->lock_all(mode::no_check);
+    buffer_   = static_cast<std::byte*>(window_->query_shared(0).base);
+    capacity_ = std::max(bytes, 2 * capacity_);
+  }
+  // Makes the stores of each process visible to the others of the node.
+  void                synchronize            () const
+  {
+    window_->synchronize();
+    topology_.node().barrier();
+    window_->synchronize();
+  }
+
+  topology_descriptor           topology_    ;
+
+  mutable std::optional<window> window_      ;
+  mutable std::byte*            buffer_      = nullptr;
+  mutable std::size_t           capacity_    = 0;
+};
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/error/standard_error_classes.hpp>
+#include <mpi/core/structs/compression_policy.hpp>
+#include <mpi/core/utility/compression.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/status.hpp>
+
+// A compressed request owns the compressed buffer of an immediate compressed send or receive (see communicator::immediate_compressed_send). The size of a
+// compressed message is not known in advance, hence a receive is only posted once test() finds the message through a matched probe, and the data is
+// decompressed upon completion. The statuses describe the compressed messages. Destroying an incomplete request waits for its completion.
+namespace mpi
+{
+class compressed_request
+{
+public:
+  // Send.
+  compressed_request           (request&& request, std::vector<std::byte>&& buffer)
+  : request_(std::move(request)), buffer_(std::move(buffer)), receive_(false)
+  {
+
+  }
+  // Receive.
+  compressed_request           (const MPI_Comm communicator, const std::int32_t source, const std::int32_t tag, void* data, const std::size_t size, const compression_policy& policy = {})
+  : request_(MPI_REQUEST_NULL, true), receive_(true), communicator_(communicator), source_(source), tag_(tag), data_(static_cast<std::byte*>(data)), size_(size), policy_(policy)
+  {
+
+  }
+  compressed_request           (const compressed_request&  that) = delete;
+  compressed_request           (      compressed_request&& temp)
+  : request_     (std::move(temp.request_))
+  , buffer_      (std::move(temp.buffer_ ))
+  , receive_     (temp.receive_)
+  , status_      (temp.status_ )
+  , communicator_(std::exchange(temp.communicator_, MPI_COMM_NULL))
+  , source_      (temp.source_ )
+  , tag_         (temp.tag_    )
+  , data_        (temp.data_   )
+  , size_        (temp.size_   )
+  , policy_      (temp.policy_ )
+  {
+
+  }
+  virtual ~compressed_request  () noexcept(false)
+  {
+    // Receives which have not been probed yet are probed and received as well. Moved-from receives have no communicator.
+    if (!status_ && (!receive_ || communicator_ != MPI_COMM_NULL))
+      static_cast<void>(wait());
+  }
+  compressed_request& operator=(const compressed_request&  that) = delete;
+  compressed_request& operator=(      compressed_request&& temp) = delete;
+
+  [[nodiscard]]
+  std::optional<status> test()
+  {
+    if (status_)
+      return status_;
+
+    if (receive_ && request_.native() == MPI_REQUEST_NULL)
+    {
+      std::int32_t exists;
+      MPI_Message  message;
+      MPI_Status   probed ;
+      MPI_CHECK_ERROR_CODE(MPI_Improbe, (source_, tag_, communicator_, &exists, &message, &probed))
+      if (!static_cast<bool>(exists))
+        return std::nullopt;
+      post(message, probed);
+    }
+
+    if (auto result = request_.test())
+      complete(*result);
+    return status_;
+  }
+  status                wait()
+  {
+    if (status_)
+      return *status_;
+
+    if (receive_ && request_.native() == MPI_REQUEST_NULL)
+    {
+      MPI_Message message;
+      MPI_Status  probed ;
+      MPI_CHECK_ERROR_CODE(MPI_Mprobe, (source_, tag_, communicator_, &message, &probed))
+      post(message, probed);
+    }
+
+    complete(request_.wait());
+    return *status_;
+  }
+
+protected:
+  void post    (MPI_Message message, const MPI_Status& probed)
+  {
+    std::int32_t size;
+    MPI_CHECK_ERROR_CODE(MPI_Get_count, (&probed, MPI_BYTE, &size))
+    buffer_.resize(static_cast<std::size_t>(size));
+
+    MPI_Request native;
+    MPI_CHECK_ERROR_CODE(MPI_Imrecv, (buffer_.data(), size, MPI_BYTE, &message, &native))
+    request_ = request(native, true);
+  }
+  void complete(const status& result)
+  {
+    status_ = result;
+    if (!receive_)
+      return;
+
+    const auto valid = decompressed_size(buffer_) == size_ && decompress(buffer_, data_, size_, policy_);
+#ifdef MPI_USE_EXCEPTIONS
+    if (!valid)
+      throw exception("compressed_request", error::truncate);
+#else
+    static_cast<void>(valid);
+#endif
+    buffer_.clear();
+  }
+
+  request                request_     ;
+  std::vector<std::byte> buffer_      ;
+  bool                   receive_     ;
+  std::optional<status>  status_      ;
+
+  MPI_Comm               communicator_ = MPI_COMM_NULL;
+  std::int32_t           source_       = MPI_ANY_SOURCE;
+  std::int32_t           tag_          = MPI_ANY_TAG;
+  std::byte*             data_         = nullptr;
+  std::size_t            size_         = 0;
+  compression_policy     policy_       ;
+};
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Floating-point addition is not associative, hence the result of a native sum reduction depends on the number of processes and the order in which the
+// implementation combines their contributions. An exact accumulator represents a sum of doubles without rounding as a fixed-point integer over the entire
+// exponent range of double, split into 32-bit limbs stored in 64-bit integers. The limbs of two accumulators are combined by integer addition, which is
+// associative, hence a native MPI_SUM over MPI_INT64_T yields the same accumulator (and the same rounded value) regardless of the reduction order.
+//
+// Each limb has headroom for 2^30 additions before normalization. Only finite values are supported.
+namespace mpi
+{
+class exact_accumulator
+{
+public:
+  static constexpr std::int32_t limb_bits   = 32;
+  static constexpr std::int32_t minimum_bit = std::numeric_limits<double>::min_exponent - std::numeric_limits<double>::digits; // Exponent of the least significant bit of the smallest subnormal.
+  static constexpr std::size_t  limb_count  = (std::numeric_limits<double>::max_exponent - minimum_bit) / limb_bits + 2;
+
+  template <std::floating_point type>
+  void                  add      (const type value)
+  {
+    add(value, limbs_.data(), 0);
+  }
+  void                  add      (const exact_accumulator& that)
+  {
+    for (std::size_t i = 0; i < limb_count; ++i)
+      limbs_[i] += that.limbs_[i];
+  }
+
+  // Propagates the carries such that all limbs but the most significant one are within [0, 2^32). The normalized representation of a sum is unique.
+  void                  normalize()
+  {
+    normalize(limbs_.data(), limb_count);
+  }
+
+  // Rounds the sum to the nearest double (subnormal results may be rounded twice). As the normalized representation is unique, so is the result.
+  [[nodiscard]]
+  double                value    () const
+  {
+    auto copy = limbs_;
+    return round(copy.data(), 0, limb_count);
+  }
+
+  [[nodiscard]]
+  std::int64_t*         data     ()
+  {
+    return limbs_.data();
+  }
+  [[nodiscard]]
+  const std::int64_t*   data     () const
+  {
+    return limbs_.data();
+  }
+
+  // The functions below operate on the limbs [lowest, lowest + size) of an accumulator stored at the given address, which suffices for values of limited range.
+
+  // The least significant of the three limbs which the value is added to. Undefined for zero.
+  template <std::floating_point type>
+  static std::size_t    limb     (const type value)
+  {
+    std::int32_t exponent;
+    static_cast<void>(std::frexp(static_cast<double>(value), &exponent));
+    return static_cast<std::size_t>(std::max(exponent - std::numeric_limits<double>::digits - minimum_bit, 0) / limb_bits);
+  }
+  template <std::floating_point type>
+  static void           add      (const type value, std::int64_t* limbs, const std::size_t lowest)
+  {
+    static_assert(std::numeric_limits<type>::digits <= std::numeric_limits<double>::digits, "Exact accumulation is limited to types representable as double.");
+
+    if (value == type(0))
+      return;
+
+    std::int32_t exponent;
+    const auto   mantissa  = static_cast<std::int64_t>(std::ldexp(std::frexp(static_cast<double>(value), &exponent), std::numeric_limits<double>::digits));
+    const auto   sign      = mantissa < 0 ? std::int64_t(-1) : std::int64_t(1);
+    auto         bit       = exponent - std::numeric_limits<double>::digits - minimum_bit;
+    auto         magnitude = static_cast<std::uint64_t>(sign * mantissa);
+    if (bit < 0) // Subnormals, whose mantissa bits below the smallest subnormal are zero.
+    {
+      magnitude >>= -bit;
+      bit         = 0;
+    }
+    const auto   limb      = static_cast<std::size_t>(bit / limb_bits) - lowest;
+    const auto   shift     = bit % limb_bits;
+
+    // The magnitude is split into two halves first, as a 53-bit mantissa shifted by up to 31 bits exceeds 64 bits.
+    const auto   low       = (magnitude & mask) << shift;
+    const auto   high      = (magnitude >> limb_bits) << shift;
+    limbs[limb    ] += sign * static_cast<std::int64_t>(low & mask);
+    limbs[limb + 1] += sign * static_cast<std::int64_t>((low >> limb_bits) + (high & mask));
+    limbs[limb + 2] += sign * static_cast<std::int64_t>(high >> limb_bits);
+  }
+  [[nodiscard]]
+  static double         value    (const std::int64_t* limbs, const std::size_t lowest, const std::size_t size)
+  {
+    // Two further limbs hold the carries of up to 2^30 additions.
+    const auto                           extended_size = std::min(size + 2, limb_count - lowest);
+    std::array<std::int64_t, limb_count> copy;
+    std::copy_n(limbs, size, copy.data());
+    std::fill  (copy.data() + size, copy.data() + extended_size, 0);
+    return round(copy.data(), lowest, extended_size);
+  }
+
+protected:
+  static constexpr std::uint64_t mask = (std::uint64_t(1) << limb_bits) - 1;
+
+  static void           normalize(std::int64_t* limbs, const std::size_t size)
+  {
+    for (std::size_t i = 0; i + 1 < size; ++i)
+    {
+      const auto carry = limbs[i] >> limb_bits; // Arithmetic shift, rounding towards negative infinity.
+      limbs[i    ] -= carry * (std::int64_t(1) << limb_bits);
+      limbs[i + 1] += carry;
+    }
+  }
+  // Normalizes the limbs in place.
+  static double         round    (std::int64_t* limbs, const std::size_t lowest, const std::size_t size)
+  {
+    normalize(limbs, size);
+
+    const auto negative = limbs[size - 1] < 0;
+    if (negative)
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        limbs[i] = -limbs[i];
+      normalize(limbs, size);
+    }
+
+    auto top = size;
+    while (top > 0 && limbs[top - 1] == 0)
+      --top;
+    if (top == 0)
+      return 0.0;
+    --top;
+
+    // The 64 most significant bits of the magnitude, with any remaining bits folded into the least significant one, round correctly to 53 bits.
+    const auto limb   = [&] (const std::size_t index) { return index <= top ? static_cast<std::uint64_t>(limbs[index]) : std::uint64_t(0); };
+    const auto width  = static_cast<std::int32_t>(std::bit_width(limb(top)));
+    const auto third  = top - 2; // Wraps around for top < 2, yielding zero limbs.
+    auto       bits   = (limb(top) << (64 - width)) | (limb(top - 1) << (limb_bits - width)) | (limb(third) >> width);
+    bool       sticky = (limb(third) & ((std::uint64_t(1) << width) - 1)) != 0;
+    for (std::size_t i = 0; i + 2 < top; ++i)
+      sticky = sticky || limbs[i] != 0;
+    bits |= static_cast<std::uint64_t>(sticky);
+
+    const auto result = std::ldexp(static_cast<double>(bits), minimum_bit + (static_cast<std::int32_t>(lowest + top) - 2) * limb_bits + width);
+    return negative ? -result : result;
+  }
+
+  std::array<std::int64_t, limb_count> limbs_ {};
+};
+}
\ No newline at end of file
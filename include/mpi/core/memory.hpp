@@ -10,7 +10,7 @@ template <typename type = void>
 type*       allocate   (const aint size, const information& info = information())
 {
   type* result {};
-  MPI_CHECK_ERROR_CODE(MPI_Alloc_mem, (size, info.native(), result))
+  MPI_CHECK_ERROR_CODE(MPI_Alloc_mem, (size, info.native(), &result))
   return result;
 }
 template <typename type = void>
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/information.hpp>
+#include <mpi/core/memory.hpp>
+#include <mpi/core/mpi.hpp>
+
+// Memory allocated through MPI_Alloc_mem may be registered with the network (pinned), which avoids registering send and receive buffers and windows per
+// transfer, but allocating it is costly. A memory pool carves blocks of power of two size classes out of slabs allocated through MPI_Alloc_mem, and keeps the
+// freed blocks of each class for reuse. Each thread caches a number of free blocks per class, such that most allocations take no lock. Allocations exceeding
+// the largest class are forwarded to MPI_Alloc_mem directly.
+//
+// The slabs are released through MPI_Free_mem upon destruction of the pool, which must precede finalization and succeed the deallocation of all blocks.
+// Allocating slabs from several threads requires MPI_THREAD_MULTIPLE.
+namespace mpi
+{
+class memory_pool
+{
+public:
+  static constexpr std::size_t minimum_block_size = 64;
+  static constexpr std::size_t maximum_block_size = std::size_t(1) << 20;
+  static constexpr std::size_t slab_alignment     = 4096; // Blocks are aligned to their size, up to the slab alignment.
+  static constexpr std::size_t class_count        = std::countr_zero(maximum_block_size) - std::countr_zero(minimum_block_size) + 1;
+
+  explicit memory_pool  (const std::size_t slab_size = std::size_t(1) << 22, const std::size_t cache_size = 32, const information& information = mpi::information())
+  : state_(std::make_shared<state>(std::max(slab_size, maximum_block_size), std::max<std::size_t>(cache_size, 1), information))
+  {
+
+  }
+  memory_pool           (const memory_pool&  that) = delete ;
+  memory_pool           (      memory_pool&& temp) = default;
+  virtual ~memory_pool  () noexcept(false)
+  {
+    if (!state_)
+      return;
+
+    for (const auto& slab : state_->slabs)
+      mpi::free(slab);
+    for (const auto& [location, size] : state_->large)
+      mpi::free(location);
+  }
+  memory_pool& operator=(const memory_pool&  that) = delete ;
+  memory_pool& operator=(      memory_pool&& temp) = delete ;
+
+  [[nodiscard]]
+  void* allocate  (const std::size_t size, const std::size_t alignment = alignof(std::max_align_t))
+  {
+    if (alignment > slab_alignment)
+      throw std::bad_alloc();
+
+    const auto block = std::max(size, alignment);
+    if (block > maximum_block_size)
+    {
+      void* result = mpi::allocate(static_cast<aint>(block), state_->information);
+      std::lock_guard lock(state_->mutex);
+      state_->large.emplace(result, block);
+      return result;
+    }
+
+    auto& list = local_cache()[size_class(block)];
+    if (list.empty())
+      refill(size_class(block), list);
+    const auto result = list.back();
+    list.pop_back();
+    return result;
+  }
+  // The size and alignment must be those passed to allocate.
+  void  deallocate(void* location, const std::size_t size, const std::size_t alignment = alignof(std::max_align_t))
+  {
+    if (location == nullptr)
+      return;
+
+    const auto block = std::max(size, alignment);
+    if (block > maximum_block_size)
+    {
+      {
+        std::lock_guard lock(state_->mutex);
+        state_->large.erase(location);
+      }
+      mpi::free(location);
+      return;
+    }
+
+    const auto index = size_class(block);
+    auto&      list  = local_cache()[index];
+    list.push_back(location);
+    if (list.size() >= 2 * state_->cache_size) // Returns half of the cache to the pool, such that blocks freed by other threads than they were allocated by are reused.
+    {
+      std::lock_guard lock(state_->mutex);
+      state_->free_lists[index].insert(state_->free_lists[index].end(), list.end() - static_cast<std::ptrdiff_t>(state_->cache_size), list.end());
+      list.resize(list.size() - state_->cache_size);
+    }
+  }
+
+  // The total size of the slabs and the large allocations.
+  [[nodiscard]]
+  std::size_t allocated_size() const
+  {
+    std::lock_guard lock(state_->mutex);
+    auto result = state_->slabs.size() * state_->slab_size;
+    for (const auto& [location, size] : state_->large)
+      result += size;
+    return result;
+  }
+
+  [[nodiscard]]
+  static std::size_t size_class(const std::size_t size)
+  {
+    return static_cast<std::size_t>(std::countr_zero(std::bit_ceil(std::max(size, minimum_block_size))) - std::countr_zero(minimum_block_size));
+  }
+
+protected:
+  using cache = std::array<std::vector<void*>, class_count>;
+
+  struct state
+  {
+    state(const std::size_t slab_size, const std::size_t cache_size, const mpi::information& information)
+    : slab_size(slab_size), cache_size(cache_size), information(information)
+    {
+
+    }
+
+    std::size_t                                 slab_size  ;
+    std::size_t                                 cache_size ;
+    mpi::information                            information;
+
+    mutable std::mutex                          mutex      ;
+    std::vector<void*>                          slabs      ;
+    std::unordered_map<void*, std::size_t>      large      ; // Allocations exceeding the largest class, to their size.
+    std::array<std::vector<void*>, class_count> free_lists ; // Per class.
+  };
+
+  // The cache of the calling thread for this pool. Returns the cached blocks to the pool upon exit of the thread, unless the pool has been destroyed.
+  cache& local_cache()
+  {
+    struct entry
+    {
+      const state*         key   ; // As long as the owner has not expired, no other state resides at the same address.
+      std::weak_ptr<state> owner ;
+      cache                blocks;
+    };
+    struct thread_caches
+    {
+      ~thread_caches()
+      {
+        for (auto& entry : entries)
+          if (const auto owner = entry.owner.lock())
+          {
+            std::lock_guard lock(owner->mutex);
+            for (std::size_t i = 0; i < class_count; ++i)
+              owner->free_lists[i].insert(owner->free_lists[i].end(), entry.blocks[i].begin(), entry.blocks[i].end());
+          }
+      }
+
+      std::vector<entry> entries;
+    };
+    thread_local thread_caches local;
+
+    for (auto iterator = local.entries.begin(); iterator != local.entries.end();)
+    {
+      if (iterator->owner.expired())
+        iterator = local.entries.erase(iterator);
+      else if (iterator->key == state_.get())
+        return iterator->blocks;
+      else
+        ++iterator;
+    }
+    return local.entries.emplace_back(state_.get(), state_, cache()).blocks;
+  }
+  // Moves up to cache_size blocks of the class from the pool to the list, allocating a slab if the pool has none.
+  void   refill     (const std::size_t index, std::vector<void*>& list)
+  {
+    const auto      block = minimum_block_size << index;
+    std::lock_guard lock(state_->mutex);
+
+    auto& free_list = state_->free_lists[index];
+    if (free_list.empty())
+    {
+      // The slab is over-allocated by the slab alignment, and the blocks start at the first aligned address.
+      const auto slab  = mpi::allocate<std::byte>(static_cast<aint>(state_->slab_size + slab_alignment), state_->information);
+      state_->slabs.push_back(slab);
+      const auto first = slab + (slab_alignment - reinterpret_cast<std::uintptr_t>(slab) % slab_alignment) % slab_alignment;
+      for (auto offset = state_->slab_size / block; offset-- > 0;)
+        free_list.push_back(first + offset * block);
+    }
+
+    const auto count = std::min(state_->cache_size, free_list.size());
+    list.insert(list.end(), free_list.end() - static_cast<std::ptrdiff_t>(count), free_list.end());
+    free_list.resize(free_list.size() - count);
+  }
+
+  std::shared_ptr<state> state_;
+};
+
+// Adapts a memory pool to std::pmr, such that standard containers (e.g. std::pmr::vector) reside in memory allocated through MPI_Alloc_mem.
+class memory_pool_resource : public std::pmr::memory_resource
+{
+public:
+  explicit memory_pool_resource  (memory_pool& pool) : pool_(pool)
+  {
+
+  }
+  memory_pool_resource           (const memory_pool_resource&  that) = default;
+  memory_pool_resource           (      memory_pool_resource&& temp) = default;
+  ~memory_pool_resource          () override                         = default;
+  memory_pool_resource& operator=(const memory_pool_resource&  that) = delete ;
+  memory_pool_resource& operator=(      memory_pool_resource&& temp) = delete ;
+
+  [[nodiscard]]
+  memory_pool& pool() const
+  {
+    return pool_;
+  }
+
+protected:
+  void* do_allocate   (const std::size_t bytes, const std::size_t alignment) override
+  {
+    return pool_.allocate(bytes, alignment);
+  }
+  void  do_deallocate (void* location, const std::size_t bytes, const std::size_t alignment) override
+  {
+    pool_.deallocate(location, bytes, alignment);
+  }
+  [[nodiscard]]
+  bool  do_is_equal   (const std::pmr::memory_resource& that) const noexcept override
+  {
+    const auto resource = dynamic_cast<const memory_pool_resource*>(&that);
+    return resource != nullptr && &resource->pool_ == &pool_;
+  }
+
+  memory_pool& pool_;
+};
+}
\ No newline at end of file
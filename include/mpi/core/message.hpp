@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include <mpi/core/type/large_count.hpp>
 #include <mpi/core/utility/container_adapter.hpp>
 #include <mpi/core/exception.hpp>
 #include <mpi/core/mpi.hpp>
@@ -23,24 +24,34 @@ public:
   message& operator=(const message&    that) = default;
   message& operator=(      message&&   temp) = default;
 
-  status      receive          (void* data, const std::int32_t size, const data_type& data_type)
+  status      receive          (void* data, const count        size, const data_type& data_type)
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_Mrecv, (data, size, data_type.native(), &native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Mrecv_c, (data, size, data_type.native(), &native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Mrecv  , (data, large.size(), large.data_type(), &native_, &result.native_))
+#endif
     return result;
   }
   template <typename type>
   status      receive          (type& data)
   {
     using adapter = container_adapter<type>;
-    return receive(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
 
   [[nodiscard]]
-  request     immediate_receive(void* data, const std::int32_t size, const data_type& data_type)
+  request     immediate_receive(void* data, const count        size, const data_type& data_type)
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_Imrecv, (data, size, data_type.native(), &native_, &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Imrecv_c, (data, size, data_type.native(), &native_, &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_Imrecv  , (data, large.size(), large.data_type(), &native_, &result.native_))
+#endif
     return result;
   }
   template <typename type>
@@ -48,7 +59,7 @@ public:
   request     immediate_receive(type& data)
   {
     using adapter = container_adapter<type>;
-    return immediate_receive(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_receive(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
 
   [[nodiscard]]
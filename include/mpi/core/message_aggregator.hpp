@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/structs/aggregation_policy.hpp>
+#include <mpi/core/type/standard_data_types.hpp>
+#include <mpi/core/utility/termination.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/standard_ops.hpp>
+#include <mpi/core/time.hpp>
+
+// Sending many small messages is dominated by the per-message overhead of MPI. A message aggregator instead buffers records per destination and sends each
+// buffer as a single message (see aggregation_policy), the receiver unpacks the message and invokes the handler once per record. The records are transferred
+// as bytes, hence must be trivially copyable and the processes must share their representation.
+//
+// Incoming messages are only received within progress() and synchronize(), which must be called regularly. The handler may send further records, but must not
+// call progress() or synchronize(). The tag must not be used for other messages on the communicator while the aggregator exists.
+namespace mpi
+{
+template <typename record_type>
+class message_aggregator
+{
+public:
+  static_assert(std::is_trivially_copyable_v<record_type>, "Records are transferred as bytes, hence must be trivially copyable.");
+
+  using handler_type = std::function<void(const record_type& record, std::int32_t source)>;
+
+  message_aggregator           (const communicator& communicator, handler_type handler, const aggregation_policy& policy = {}, const std::int32_t tag = 0)
+  : communicator_  (communicator)
+  , handler_       (std::move(handler))
+  , tag_           (tag)
+  , maximum_count_ (std::max<std::size_t>(std::min(policy.maximum_count, policy.maximum_size / sizeof(record_type)), 1))
+  , maximum_delay_ (policy.maximum_delay)
+  , buffers_       (static_cast<std::size_t>(communicator_.size()))
+  , buffered_since_(static_cast<std::size_t>(communicator_.size()), 0.0)
+  , sent_counts_   (static_cast<std::size_t>(communicator_.size()), 0)
+  {
+
+  }
+  message_aggregator           (const message_aggregator&  that) = delete ;
+  message_aggregator           (      message_aggregator&& temp) = default;
+  // Sends the buffered records and waits for the pending sends, as their buffers are owned by the aggregator.
+  virtual ~message_aggregator  () noexcept(false)
+  {
+    flush();
+    for (auto& entry : in_flight_)
+      entry.first.wait();
+  }
+  message_aggregator& operator=(const message_aggregator&  that) = delete ;
+  message_aggregator& operator=(      message_aggregator&& temp) = delete ;
+
+  void        send       (const record_type& record, const std::int32_t destination)
+  {
+    const auto time   = wall_clock_time();
+    auto&      buffer = buffers_[destination];
+    if (buffer.empty())
+    {
+      buffered_since_[destination] = time;
+      oldest_                      = std::min(oldest_, time);
+      if (buffer.capacity() < maximum_count_ && !free_buffers_.empty())
+      {
+        buffer = std::move(free_buffers_.back());
+        free_buffers_.pop_back();
+      }
+    }
+
+    buffer.push_back(record);
+    if (buffer.size() >= maximum_count_)
+      flush(destination);
+    flush_expired(time);
+  }
+
+  // Sends the records buffered for the destination immediately.
+  void        flush      (const std::int32_t destination)
+  {
+    auto& buffer = buffers_[destination];
+    if (buffer.empty())
+      return;
+
+    auto request = communicator_.immediate_send(buffer.data(), static_cast<count>(buffer.size() * sizeof(record_type)), data_types::byte, destination, tag_);
+    in_flight_.emplace_back(std::move(request), std::move(buffer));
+    ++sent_counts_[destination];
+
+    buffer.clear();
+    if (!free_buffers_.empty())
+    {
+      buffer = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+  }
+  void        flush      ()
+  {
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(buffers_.size()); ++i)
+      flush(i);
+    oldest_ = std::numeric_limits<double>::max();
+  }
+
+  // Dispatches the records of all arrived messages, flushes the buffers exceeding the delay and recycles the buffers of completed sends. Returns the number of
+  // messages received.
+  std::size_t progress   ()
+  {
+    std::size_t received = 0;
+    while (auto probed = communicator_.immediate_probe_message(MPI_ANY_SOURCE, tag_))
+    {
+      auto& [message, status] = *probed;
+      receive_buffer_.resize(static_cast<std::size_t>(status.count(data_types::byte)) / sizeof(record_type));
+      message.receive(receive_buffer_.data(), static_cast<count>(receive_buffer_.size() * sizeof(record_type)), data_types::byte);
+
+      const auto source = status.source();
+      for (const auto& record : receive_buffer_)
+        handler_(record, source);
+
+      ++received_count_;
+      ++received;
+    }
+
+    flush_expired(wall_clock_time());
+
+    std::erase_if(in_flight_, [&] (auto& entry)
+    {
+      if (!entry.first.test())
+        return false;
+      entry.second.clear();
+      free_buffers_.push_back(std::move(entry.second));
+      return true;
+    });
+
+    return received;
+  }
+
+  // Collective. Flushes all buffers and dispatches all records sent by any process, including those sent by the handlers in the meantime.
+  void        synchronize()
+  {
+    // The handler may buffer further records, hence the buffers are flushed after each progress.
+    flush();
+    detail::synchronize_message_counts(communicator_, sent_counts_, received_count_, [&] { progress(); flush(); });
+
+    for (auto& [request, buffer] : in_flight_)
+    {
+      request.wait();
+      buffer.clear();
+      free_buffers_.push_back(std::move(buffer));
+    }
+    in_flight_.clear();
+  }
+
+protected:
+  void        flush_expired(const double time)
+  {
+    if (time - oldest_ <= maximum_delay_)
+      return;
+
+    oldest_ = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < buffers_.size(); ++i)
+    {
+      if      (buffers_[i].empty())
+        continue;
+      if      (time - buffered_since_[i] > maximum_delay_)
+        flush(static_cast<std::int32_t>(i));
+      else
+        oldest_ = std::min(oldest_, buffered_since_[i]);
+    }
+  }
+
+  const communicator&                                       communicator_  ;
+  handler_type                                              handler_       ;
+  std::int32_t                                              tag_           ;
+  std::size_t                                               maximum_count_ ;
+  double                                                    maximum_delay_ ;
+
+  std::vector<std::vector<record_type>>                     buffers_       ; // Per destination.
+  std::vector<double>                                       buffered_since_; // Per destination.
+  std::vector<std::uint64_t>                                sent_counts_   ; // Per destination, cumulative.
+  std::uint64_t                                             received_count_ = 0; // Cumulative.
+  double                                                    oldest_         = std::numeric_limits<double>::max();
+
+  std::vector<std::pair<request, std::vector<record_type>>> in_flight_     ;
+  std::vector<std::vector<record_type>>                     free_buffers_  ;
+  std::vector<record_type>                                  receive_buffer_;
+};
+}
\ No newline at end of file
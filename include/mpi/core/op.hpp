@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <type_traits>
 
 #include <mpi/core/exception.hpp>
 #include <mpi/core/mpi.hpp>
@@ -74,4 +77,30 @@ protected:
   bool   managed_ = false;
   MPI_Op native_  = MPI_OP_NULL;
 };
+// Creates an op from a stateless callable, which is either applied element-wise as `type(const type& input, const type& input_output)` or to the complete
+// buffers as `void(std::span<const type> input, std::span<type> input_output)`. The callback is generated at compile time for the given type, hence it does not
+// dispatch on the data type and the element-wise loop is visible to the compiler. The op must only be used with the data type of `type`.
+template <typename type, typename function_type>
+op make_op([[maybe_unused]] const function_type& function, const bool commutative = true)
+{
+  static_assert(std::is_empty_v<function_type> && std::is_default_constructible_v<function_type>, "The function must be stateless (e.g. a lambda without captures).");
+
+  return op([ ] (void* input, void* input_output, std::int32_t* length, MPI_Datatype*)
+  {
+    const auto  size = static_cast<std::size_t>(*length);
+    const auto* lhs  = static_cast<const type*>(input       );
+    auto*       rhs  = static_cast<      type*>(input_output);
+
+    if constexpr (std::is_invocable_r_v<type, function_type, const type&, const type&>)
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        rhs[i] = function_type()(lhs[i], rhs[i]);
+    }
+    else
+    {
+      static_assert(std::is_invocable_v<function_type, std::span<const type>, std::span<type>>, "The function must be invocable either element-wise or on spans.");
+      function_type()(std::span<const type>(lhs, size), std::span<type>(rhs, size));
+    }
+  }, commutative);
+}
 }
\ No newline at end of file
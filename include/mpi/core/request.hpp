@@ -132,7 +132,10 @@ public:
 
 protected:
   friend class communicator;
+  friend class detach_context;
   friend class message;
+  friend class request_scheduler;
+  friend class request_set;
   friend class topological_communicator;
   friend class window;
   friend class io::file;
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/status.hpp>
+
+// The free completion functions (test_all, wait_all, ...) copy the native handles of a std::vector<request> into a temporary array and back on each call.
+// A request set instead stores the native handles, the statuses and the indices of completed requests in contiguous arrays which are passed to MPI directly,
+// hence completing the requests does not allocate.
+namespace mpi
+{
+class request_set
+{
+public:
+  explicit request_set  (const std::size_t capacity = 0)
+  {
+    reserve(capacity);
+  }
+  explicit request_set  (std::vector<request>&& requests)
+  {
+    reserve(requests.size());
+    for (auto& request : requests)
+      insert(std::move(request));
+  }
+  request_set           (const request_set&  that) = delete;
+  request_set           (      request_set&& temp) = default;
+  virtual ~request_set  () noexcept(false)
+  {
+    clear();
+  }
+  request_set& operator=(const request_set&  that) = delete;
+  request_set& operator=(      request_set&& temp) noexcept(false)
+  {
+    if (this != &temp)
+    {
+      clear();
+
+      natives_            = std::move(temp.natives_           );
+      managed_            = std::move(temp.managed_           );
+      statuses_           = std::move(temp.statuses_          );
+      completed_statuses_ = std::move(temp.completed_statuses_);
+      indices_            = std::move(temp.indices_           );
+    }
+    return *this;
+  }
+
+  // Takes ownership of the request, which is left null. Returns the index of the request within the set.
+  std::size_t                      insert    (request&& request)
+  {
+    natives_           .push_back(request.native_ );
+    managed_           .push_back(request.managed_);
+    statuses_          .emplace_back();
+    completed_statuses_.emplace_back();
+    indices_           .emplace_back();
+
+    request.managed_ = false;
+    request.native_  = MPI_REQUEST_NULL;
+
+    return natives_.size() - 1;
+  }
+  void                             reserve   (const std::size_t capacity)
+  {
+    natives_           .reserve(capacity);
+    managed_           .reserve(capacity);
+    statuses_          .reserve(capacity);
+    completed_statuses_.reserve(capacity);
+    indices_           .reserve(capacity);
+  }
+  void                             clear     ()
+  {
+    for (std::size_t i = 0; i < natives_.size(); ++i)
+      if (managed_[i] && natives_[i] != MPI_REQUEST_NULL)
+        MPI_CHECK_ERROR_CODE(MPI_Request_free, (&natives_[i]))
+
+    natives_           .clear();
+    managed_           .clear();
+    statuses_          .clear();
+    completed_statuses_.clear();
+    indices_           .clear();
+  }
+
+  [[nodiscard]]
+  bool                             test_all  ()
+  {
+    std::int32_t complete(0);
+    MPI_CHECK_ERROR_CODE(MPI_Testall, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &complete, statuses_.data()))
+    return static_cast<bool>(complete);
+  }
+  // The status of the completed request is accessible through status(index).
+  [[nodiscard]]
+  std::optional<std::int32_t>      test_any  ()
+  {
+    std::int32_t complete(0);
+    std::int32_t index   (0);
+    MPI_Status   status  {};
+    MPI_CHECK_ERROR_CODE(MPI_Testany, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &index, &complete, &status))
+    // MPI_CHECK_UNDEFINED (MPI_Testany, index) // MPI_UNDEFINED should not cause an exception in this case.
+
+    if (!static_cast<bool>(complete) || index == MPI_UNDEFINED)
+      return std::nullopt;
+
+    statuses_[index] = status;
+    return index;
+  }
+  // The statuses of the completed requests are accessible through status(index) for each returned index.
+  [[nodiscard]]
+  std::span<const std::int32_t>    test_some ()
+  {
+    std::int32_t count(0);
+    MPI_CHECK_ERROR_CODE(MPI_Testsome, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &count, indices_.data(), completed_statuses_.data()))
+    // MPI_CHECK_UNDEFINED (MPI_Testsome, count) // MPI_UNDEFINED should not cause an exception in this case.
+    return completed(count);
+  }
+
+  void                             wait_all  ()
+  {
+    MPI_CHECK_ERROR_CODE(MPI_Waitall, (static_cast<std::int32_t>(natives_.size()), natives_.data(), statuses_.data()))
+  }
+  // Returns std::nullopt if none of the requests is active. The status of the completed request is accessible through status(index).
+  std::optional<std::int32_t>      wait_any  ()
+  {
+    std::int32_t index (0);
+    MPI_Status   status{};
+    MPI_CHECK_ERROR_CODE(MPI_Waitany, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &index, &status))
+    // MPI_CHECK_UNDEFINED (MPI_Waitany, index) // MPI_UNDEFINED should not cause an exception in this case.
+
+    if (index == MPI_UNDEFINED)
+      return std::nullopt;
+
+    statuses_[index] = status;
+    return index;
+  }
+  // The statuses of the completed requests are accessible through status(index) for each returned index.
+  std::span<const std::int32_t>    wait_some ()
+  {
+    std::int32_t count(0);
+    MPI_CHECK_ERROR_CODE(MPI_Waitsome, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &count, indices_.data(), completed_statuses_.data()))
+    // MPI_CHECK_UNDEFINED (MPI_Waitsome, count) // MPI_UNDEFINED should not cause an exception in this case.
+    return completed(count);
+  }
+
+  void                             start_all ()
+  {
+    MPI_CHECK_ERROR_CODE(MPI_Startall, (static_cast<std::int32_t>(natives_.size()), natives_.data()))
+  }
+
+  [[nodiscard]]
+  std::size_t                      size      () const
+  {
+    return natives_.size();
+  }
+  [[nodiscard]]
+  bool                             empty     () const
+  {
+    return natives_.empty();
+  }
+  [[nodiscard]]
+  mpi::status                      status    (const std::size_t index) const
+  {
+    return {statuses_[index]};
+  }
+  [[nodiscard]]
+  std::span<const MPI_Request>     native    () const
+  {
+    return natives_;
+  }
+
+protected:
+  // MPI_Testsome and MPI_Waitsome write the statuses in order of completion, which are moved to the indices of their requests.
+  std::span<const std::int32_t>    completed (const std::int32_t count)
+  {
+    if (count == MPI_UNDEFINED)
+      return {};
+
+    for (std::int32_t i = 0; i < count; ++i)
+      statuses_[indices_[i]] = completed_statuses_[i];
+    return {indices_.data(), static_cast<std::size_t>(count)};
+  }
+
+  std::vector<MPI_Request>  natives_           ;
+  std::vector<bool>         managed_           ;
+  std::vector<MPI_Status>   statuses_          ;
+  std::vector<MPI_Status>   completed_statuses_;
+  std::vector<std::int32_t> indices_           ;
+};
+}
\ No newline at end of file
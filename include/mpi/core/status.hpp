@@ -38,6 +38,28 @@ public:
     MPI_CHECK_UNDEFINED (MPI_Get_count, result)
     return result;
   }
+  // Prior to MPI 4.0, counts exceeding the range of std::int32_t are only available as the number of basic elements, which equals the count for predefined
+  // data types. Derived data types fall back to MPI_Get_count.
+  [[nodiscard]]
+  mpi::count        count_x            (const data_type& type) const
+  {
+    mpi::count result;
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_Get_count_c, (&native_, type.native(), &result))
+    MPI_CHECK_UNDEFINED (MPI_Get_count_c, result)
+#else
+    std::int32_t integers, addresses, data_types, combiner;
+    MPI_CHECK_ERROR_CODE(MPI_Type_get_envelope, (type.native(), &integers, &addresses, &data_types, &combiner))
+    if (combiner == MPI_COMBINER_NAMED)
+    {
+      MPI_CHECK_ERROR_CODE(MPI_Get_elements_x, (&native_, type.native(), &result))
+      MPI_CHECK_UNDEFINED (MPI_Get_elements_x, result)
+    }
+    else
+      result = count(type);
+#endif
+    return result;
+  }
 
   [[nodiscard]]
   std::int32_t      element_count      (const data_type& type) const
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mpi
+{
+// The records buffered for a destination are sent once their count or size (in bytes) reaches the respective threshold, or once the oldest of them has been
+// buffered for longer than the delay (in seconds). The delay is only checked on send and progress.
+struct aggregation_policy
+{
+  std::size_t maximum_count = 1024;
+  std::size_t maximum_size  = std::size_t(1) << 16;
+  double      maximum_delay = 1e-3;
+};
+}
\ No newline at end of file
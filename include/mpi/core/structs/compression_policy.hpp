@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mpi
+{
+// Transfers of at least threshold bytes are compressed in independent chunks of chunk_size bytes, using up to thread_count threads (0 selects the hardware
+// concurrency). Smaller transfers are sent as is.
+struct compression_policy
+{
+  std::size_t  threshold    = std::size_t(1) << 16;
+  std::size_t  chunk_size   = std::size_t(1) << 20;
+  std::int32_t thread_count = 0;
+};
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+namespace mpi
+{
+// A task is queued on the worker of the given affinity (modulo the worker count) if any, and on the workers in turn otherwise. Idle workers steal the tasks
+// queued on others regardless. A task of high priority is queued ahead of the others on its worker.
+struct execution_hint
+{
+  std::optional<std::size_t> affinity      ;
+  bool                       high_priority = false;
+};
+}
\ No newline at end of file
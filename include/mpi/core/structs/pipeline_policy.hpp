@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+#include <mpi/core/type/large_count.hpp>
+#include <mpi/core/mpi.hpp>
+
+namespace mpi
+{
+// Transfers exceeding the threshold (in elements) are split into segments of segment_size elements, of which at most depth are in flight at once.
+struct pipeline_policy
+{
+  count        threshold    = large_count_threshold;
+  count        segment_size = count(1) << 24;
+  std::int32_t depth        = 4;
+};
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mpi
+{
+// A progress thread polls continuously for the given number of sweeps without completions, then yields for the given number of sweeps, then sleeps for a
+// duration (in seconds) doubling from the minimum to the maximum backoff. Any completion or submission resets it to polling.
+struct progress_policy
+{
+  std::size_t spin_count      = 1024;
+  std::size_t yield_count     = 1024;
+  double      minimum_backoff = 1e-6;
+  double      maximum_backoff = 1e-4;
+};
+}
\ No newline at end of file
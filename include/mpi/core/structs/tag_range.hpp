@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mpi
+{
+// The tags [first, first + count).
+struct tag_range
+{
+  std::int32_t first = 0;
+  std::int32_t count = 0;
+};
+}
\ No newline at end of file
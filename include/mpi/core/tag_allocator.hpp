@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <optional>
+
+#include <mpi/core/structs/tag_range.hpp>
+
+// A tag allocator hands out disjoint ranges of the tags [0, upper_bound]. The ranges are taken from the highest free tags downwards, leaving the lowest tags
+// (including the default tag 0) to code which uses tags directly. Allocation is local, hence processes which allocate and release the same counts in the same
+// order obtain the same ranges.
+namespace mpi
+{
+class tag_allocator
+{
+public:
+  explicit tag_allocator  (const std::int32_t upper_bound)
+  : free_ranges_ {{0, upper_bound}}
+  {
+
+  }
+  tag_allocator           (const tag_allocator&  that) = default;
+  tag_allocator           (      tag_allocator&& temp) = default;
+  virtual ~tag_allocator  ()                           = default;
+  tag_allocator& operator=(const tag_allocator&  that) = default;
+  tag_allocator& operator=(      tag_allocator&& temp) = default;
+
+  // Returns std::nullopt if no free range of the given count exists.
+  [[nodiscard]]
+  std::optional<tag_range> allocate(const std::int32_t count)
+  {
+    for (auto iterator = free_ranges_.rbegin(); iterator != free_ranges_.rend(); ++iterator)
+    {
+      auto& [first, last] = *iterator;
+      if (last - first < count - 1)
+        continue;
+
+      const tag_range result {last - count + 1, count};
+      if (result.first == first)
+        free_ranges_.erase(std::next(iterator).base());
+      else
+        last -= count;
+      return result;
+    }
+    return std::nullopt;
+  }
+  // The range must have been returned by allocate.
+  void                     release (const tag_range& range)
+  {
+    auto next    = free_ranges_.lower_bound(range.first);
+    auto current = free_ranges_.emplace_hint(next, range.first, range.first + range.count - 1);
+
+    if (next != free_ranges_.end() && current->second + 1 == next->first)
+    {
+      current->second = next->second;
+      free_ranges_.erase(next);
+    }
+    if (current != free_ranges_.begin())
+    {
+      if (auto previous = std::prev(current); previous->second + 1 == current->first)
+      {
+        previous->second = current->second;
+        free_ranges_.erase(current);
+      }
+    }
+  }
+
+  // The number of free tags, which may be fragmented.
+  [[nodiscard]]
+  std::int64_t             free_count() const
+  {
+    std::int64_t result = 0;
+    for (const auto& [first, last] : free_ranges_)
+      result += std::int64_t(last) - first + 1;
+    return result;
+  }
+
+protected:
+  std::map<std::int32_t, std::int32_t> free_ranges_; // First to last tag, inclusive.
+};
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/enums/split_type.hpp>
+#include <mpi/core/enums/topology.hpp>
+#include <mpi/core/type/type_traits.hpp>
+#include <mpi/core/utility/cached_attribute.hpp>
+#include <mpi/core/environment.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+
+// A topology descriptor captures the properties of a communicator which are invariant over its lifetime, including the placement of its processes on nodes
+// (sets of processes sharing memory), such that they are queried without calling into MPI. Nodes are numbered in the order of their leaders, the process of
+// lowest rank on each node.
+//
+// Constructing a descriptor is collective over the communicator. Node information is only available for intracommunicators.
+namespace mpi
+{
+class topology_descriptor
+{
+public:
+  explicit topology_descriptor  (const communicator& communicator)
+  : topology_descriptor(communicator, std::nullopt)
+  {
+
+  }
+  // Groups the processes into nodes by color rather than shared memory.
+  topology_descriptor           (const communicator& communicator, const std::optional<std::int32_t> color)
+  : rank_                (communicator.rank                ())
+  , size_                (communicator.size                ())
+  , topology_            (communicator.topology            ())
+  , is_intercommunicator_(communicator.is_intercommunicator())
+  {
+    hostnames_.resize(static_cast<std::size_t>(size_));
+    if (is_intercommunicator_)
+      return;
+
+    node_      = color ? mpi::communicator(communicator, *color, rank_) : mpi::communicator(communicator, split_type::shared, rank_);
+    node_rank_ = node_.rank();
+    leaders_   = mpi::communicator(communicator, is_leader() ? 0 : MPI_UNDEFINED, rank_);
+
+    std::int32_t node_index = is_leader() ? leaders_.rank() : 0;
+    node_.broadcast(node_index);
+
+    std::vector<std::int32_t> local {node_index, node_.rank()};
+    std::vector<std::int32_t> global(2 * static_cast<std::size_t>(size_));
+    communicator.all_gather(local, global);
+
+    node_indices_.resize(static_cast<std::size_t>(size_));
+    node_ranks_  .resize(static_cast<std::size_t>(size_));
+    for (std::size_t i = 0; i < node_indices_.size(); ++i)
+    {
+      node_indices_[i] = global[2 * i    ];
+      node_ranks_  [i] = global[2 * i + 1];
+    }
+
+    const auto node_count = static_cast<std::size_t>(*std::ranges::max_element(node_indices_)) + 1;
+    node_sizes_  .resize(node_count    , 0);
+    node_offsets_.resize(node_count + 1, 0);
+    for (const auto index : node_indices_)
+      ++node_sizes_[index];
+    for (std::size_t i = 0; i < node_count; ++i)
+      node_offsets_[i + 1] = node_offsets_[i] + node_sizes_[i];
+
+    std::string              name    = processor_name();
+    std::vector<char>        names   (static_cast<std::size_t>(size_) * MPI_MAX_PROCESSOR_NAME);
+    name.resize(MPI_MAX_PROCESSOR_NAME, '\0');
+    communicator.all_gather(name.data(), MPI_MAX_PROCESSOR_NAME, type_traits<char>::get_data_type(), names.data(), MPI_MAX_PROCESSOR_NAME, type_traits<char>::get_data_type());
+    for (std::size_t i = 0; i < hostnames_.size(); ++i)
+      hostnames_[i] = names.data() + i * MPI_MAX_PROCESSOR_NAME;
+  }
+  topology_descriptor           (const topology_descriptor&  that) = delete ;
+  topology_descriptor           (      topology_descriptor&& temp) = default;
+  virtual ~topology_descriptor  ()                                 = default;
+  topology_descriptor& operator=(const topology_descriptor&  that) = delete ;
+  topology_descriptor& operator=(      topology_descriptor&& temp) = default;
+
+  [[nodiscard]]
+  std::int32_t                     rank                () const
+  {
+    return rank_;
+  }
+  [[nodiscard]]
+  std::int32_t                     size                () const
+  {
+    return size_;
+  }
+  [[nodiscard]]
+  mpi::topology                    topology            () const
+  {
+    return topology_;
+  }
+  [[nodiscard]]
+  bool                             is_intercommunicator() const
+  {
+    return is_intercommunicator_;
+  }
+
+  // The processes sharing memory with this process.
+  [[nodiscard]]
+  const communicator&              node                () const
+  {
+    return node_;
+  }
+  // The leaders of all nodes, null on processes other than the node leaders. It has node_count() processes.
+  [[nodiscard]]
+  const communicator&              leaders             () const
+  {
+    return leaders_;
+  }
+  [[nodiscard]]
+  bool                             is_leader           () const
+  {
+    return node_rank() == 0;
+  }
+
+  [[nodiscard]]
+  std::int32_t                     node_count          () const
+  {
+    return static_cast<std::int32_t>(node_sizes_.size());
+  }
+  [[nodiscard]]
+  std::int32_t                     node_index          (const std::int32_t process) const
+  {
+    return node_indices_[process];
+  }
+  [[nodiscard]]
+  std::int32_t                     node_index          () const
+  {
+    return node_index(rank_);
+  }
+  [[nodiscard]]
+  std::int32_t                     node_rank           (const std::int32_t process) const
+  {
+    return node_ranks_[process];
+  }
+  [[nodiscard]]
+  std::int32_t                     node_rank           () const
+  {
+    return node_rank_;
+  }
+  [[nodiscard]]
+  std::int32_t                     node_size           (const std::int32_t node) const
+  {
+    return node_sizes_[node];
+  }
+  [[nodiscard]]
+  std::int32_t                     node_size           () const
+  {
+    return node_size(node_index());
+  }
+  // The number of processes on the nodes preceding the given node.
+  [[nodiscard]]
+  std::int32_t                     node_offset         (const std::int32_t node) const
+  {
+    return node_offsets_[node];
+  }
+
+  [[nodiscard]]
+  const std::string&               hostname            (const std::int32_t process) const
+  {
+    return hostnames_[process];
+  }
+  [[nodiscard]]
+  const std::string&               hostname            () const
+  {
+    return hostname(rank_);
+  }
+
+protected:
+  std::int32_t              rank_                 = 0;
+  std::int32_t              size_                 = 0;
+  mpi::topology             topology_             {};
+  bool                      is_intercommunicator_ = false;
+  std::int32_t              node_rank_            = 0;
+
+  communicator              node_                 {MPI_COMM_NULL, false};
+  communicator              leaders_              {MPI_COMM_NULL, false};
+  std::vector<std::int32_t> node_indices_         ; // Per process.
+  std::vector<std::int32_t> node_ranks_           ; // Per process.
+  std::vector<std::int32_t> node_sizes_           ; // Per node.
+  std::vector<std::int32_t> node_offsets_         ; // Per node.
+  std::vector<std::string>  hostnames_            ; // Per process.
+};
+
+// Returns the descriptor cached on the communicator (see cached_attribute), constructing it on first use, which is collective over the communicator.
+inline const topology_descriptor& cached_topology_descriptor(const communicator& communicator)
+{
+  return cached_attribute<topology_descriptor>(communicator.native(), [&] { return topology_descriptor(communicator); });
+}
+}
\ No newline at end of file
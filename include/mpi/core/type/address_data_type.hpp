@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/type/compliant_traits.hpp>
+#include <mpi/core/type/data_type.hpp>
+#include <mpi/core/type/type_traits.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+
+// Containers whose storage consists of a few contiguous blocks (std::deque, std::vector<std::string>) are described by an MPI_Type_create_hindexed over the
+// absolute addresses of their blocks, which is transmitted as a single element relative to MPI_BOTTOM without packing into a staging buffer.
+namespace mpi
+{
+// The data type of the last layout is cached per thread and element type, hence repeated transfers of an unmodified container do not recreate it.
+// Communication that is currently using a replaced data type completes normally (see MPI_Type_free). The last one is deliberately not freed, as thread local
+// destruction of the main thread occurs after finalization.
+template <typename value_type>
+data_type cached_address_data_type(std::vector<std::int32_t>& block_lengths, std::vector<aint>& displacements)
+{
+  struct entry
+  {
+    std::vector<std::int32_t> block_lengths;
+    std::vector<aint>         displacements;
+    MPI_Datatype              native = MPI_DATATYPE_NULL;
+  };
+  thread_local entry cache;
+
+  if (cache.native == MPI_DATATYPE_NULL || cache.block_lengths != block_lengths || cache.displacements != displacements)
+  {
+    if (cache.native != MPI_DATATYPE_NULL)
+      MPI_CHECK_ERROR_CODE(MPI_Type_free, (&cache.native))
+
+    MPI_CHECK_ERROR_CODE(MPI_Type_create_hindexed, (static_cast<std::int32_t>(block_lengths.size()), block_lengths.data(), displacements.data(), type_traits<value_type>::get_data_type().native(), &cache.native))
+    MPI_CHECK_ERROR_CODE(MPI_Type_commit         , (&cache.native))
+
+    std::swap(cache.block_lengths, block_lengths);
+    std::swap(cache.displacements, displacements);
+  }
+
+  return data_type(cache.native);
+}
+
+template <compliant value_type, typename allocator>
+data_type deque_data_type       (const std::deque<value_type, allocator>& deque)
+{
+  thread_local std::vector<std::int32_t> block_lengths;
+  thread_local std::vector<aint>         displacements;
+  block_lengths.clear();
+  displacements.clear();
+
+  // Blocks are delimited by discontinuities in the element addresses, as their size is implementation-defined.
+  const value_type* last = nullptr;
+  for (const auto& element : deque)
+  {
+    if (last != nullptr && &element == last + 1)
+      ++block_lengths.back();
+    else
+    {
+      aint address;
+      MPI_CHECK_ERROR_CODE(MPI_Get_address, (&element, &address))
+      block_lengths.push_back(1);
+      displacements.push_back(address);
+    }
+    last = &element;
+  }
+
+  return cached_address_data_type<value_type>(block_lengths, displacements);
+}
+
+// The strings are preceded by a header containing their number and lengths, which is the only part that is staged.
+inline data_type string_vector_data_type(const std::vector<std::string>& strings, std::vector<count>& header)
+{
+  header.resize(strings.size() + 1);
+  header[0] = static_cast<count>(strings.size());
+  for (std::size_t i = 0; i < strings.size(); ++i)
+    header[i + 1] = static_cast<count>(strings[i].size());
+
+  std::vector<std::int32_t> block_lengths(strings.size() + 1);
+  std::vector<aint>         displacements(strings.size() + 1);
+
+  block_lengths[0] = static_cast<std::int32_t>(header.size() * sizeof(count));
+  MPI_CHECK_ERROR_CODE(MPI_Get_address, (header.data(), &displacements[0]))
+  for (std::size_t i = 0; i < strings.size(); ++i)
+  {
+    block_lengths[i + 1] = static_cast<std::int32_t>(strings[i].size());
+    MPI_CHECK_ERROR_CODE(MPI_Get_address, (strings[i].data(), &displacements[i + 1]))
+  }
+
+  auto result = data_type(data_type(MPI_BYTE), block_lengths, displacements);
+  result.commit();
+  return result;
+}
+inline void      string_vector_unpack   (const std::vector<char>& buffer, std::vector<std::string>& strings)
+{
+  count size;
+  std::memcpy(&size, buffer.data(), sizeof(count));
+
+  std::vector<count> lengths(static_cast<std::size_t>(size));
+  std::memcpy(lengths.data(), buffer.data() + sizeof(count), lengths.size() * sizeof(count));
+
+  strings.resize(lengths.size());
+
+  auto iterator = buffer.data() + (lengths.size() + 1) * sizeof(count);
+  for (std::size_t i = 0; i < lengths.size(); ++i)
+  {
+    strings[i].assign(iterator, static_cast<std::size_t>(lengths[i]));
+    iterator += lengths[i];
+  }
+}
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <mpi/core/type/data_type.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/op.hpp>
+
+// MPI 4.0 provides large count variants (suffixed with _c) of the functions accepting element counts, which are used directly whenever available.
+// Prior to MPI 4.0, counts exceeding the range of std::int32_t are expressed as a single element of a derived data type consisting of `size / chunk` contiguous
+// chunks followed by the `size % chunk` remaining elements (see https://github.com/jeffhammond/BigMPI). Since predefined ops are not applicable to derived data
+// types, reductions additionally replace the op with one that forwards the underlying elements to MPI_Reduce_local.
+namespace mpi
+{
+// Defining MPI_LARGE_COUNT_THRESHOLD lowers the threshold, which exercises the chunked path without allocating billions of elements (e.g. in tests).
+#ifdef MPI_LARGE_COUNT_THRESHOLD
+inline constexpr count large_count_threshold = MPI_LARGE_COUNT_THRESHOLD;
+#else
+inline constexpr count large_count_threshold = std::numeric_limits<std::int32_t>::max();
+#endif
+
+[[nodiscard]]
+constexpr bool is_large_count(const count size)
+{
+  return size > large_count_threshold;
+}
+
+class large_count
+{
+public:
+  explicit large_count  (const count size, const data_type& data_type)
+  : size_(static_cast<std::int32_t>(size)), data_type_(data_type.native())
+  {
+    if (!is_large_count(size))
+      return;
+
+    const auto chunks    = size / large_count_threshold;
+    const auto remainder = size % large_count_threshold;
+
+    aint lower_bound, extent;
+    MPI_CHECK_ERROR_CODE(MPI_Type_get_extent, (data_type.native(), &lower_bound, &extent))
+
+    MPI_Datatype chunk_type;
+    MPI_CHECK_ERROR_CODE(MPI_Type_contiguous, (static_cast<std::int32_t>(large_count_threshold), data_type.native(), &chunk_type))
+
+    std::int32_t block_lengths[] = {static_cast<std::int32_t>(chunks), static_cast<std::int32_t>(remainder)};
+    aint         displacements[] = {0, static_cast<aint>(chunks * large_count_threshold) * extent};
+    MPI_Datatype data_types   [] = {chunk_type, data_type.native()};
+    MPI_CHECK_ERROR_CODE(MPI_Type_create_struct, (remainder > 0 ? 2 : 1, block_lengths, displacements, data_types, &data_type_))
+    MPI_CHECK_ERROR_CODE(MPI_Type_commit       , (&data_type_))
+    MPI_CHECK_ERROR_CODE(MPI_Type_free         , (&chunk_type))
+
+    size_    = 1;
+    managed_ = true;
+  }
+  explicit large_count  (const count size, const data_type& data_type, const op& op)
+  : large_count(size, data_type)
+  {
+    op_ = op.native();
+
+    if (!managed_)
+      return;
+
+    register_reduction(data_type_, data_type.native(), size, op_);
+    op_ = op.commutative() ? reduction_op<true>() : reduction_op<false>();
+  }
+  large_count           (const large_count&  that) = delete;
+  large_count           (      large_count&& temp) = delete;
+  virtual ~large_count  () noexcept(false)
+  {
+    // Communication that is currently using the data type completes normally (see MPI_Type_free).
+    if (managed_)
+      MPI_CHECK_ERROR_CODE(MPI_Type_free, (&data_type_))
+  }
+  large_count& operator=(const large_count&  that) = delete;
+  large_count& operator=(      large_count&& temp) = delete;
+
+  [[nodiscard]]
+  std::int32_t size     () const
+  {
+    return size_;
+  }
+  [[nodiscard]]
+  MPI_Datatype data_type() const
+  {
+    return data_type_;
+  }
+  [[nodiscard]]
+  MPI_Op       op       () const
+  {
+    return op_;
+  }
+
+protected:
+  struct reduction
+  {
+    MPI_Datatype data_type;
+    count        size     ;
+    MPI_Op       op       ;
+  };
+
+  // The op callback does not receive the op, hence the derived data type is mapped to the underlying reduction.
+  // An entry is overwritten once MPI reuses the handle, which implies that all communication using the previous data type has completed.
+  static std::unordered_map<MPI_Datatype, reduction>& reductions()
+  {
+    static std::unordered_map<MPI_Datatype, reduction> result;
+    return result;
+  }
+  static std::mutex&                                  reductions_mutex()
+  {
+    static std::mutex result;
+    return result;
+  }
+  static void                                         register_reduction(const MPI_Datatype derived, const MPI_Datatype underlying, const count size, const MPI_Op op)
+  {
+    // Derived underlying data types are duplicated to outlive the caller's handle. Predefined ones are stored as is, since predefined ops reject duplicates.
+    reduction entry {underlying, size, op};
+    if (!is_predefined(underlying))
+      MPI_CHECK_ERROR_CODE(MPI_Type_dup, (underlying, &entry.data_type))
+
+    std::unique_lock lock(reductions_mutex());
+    if (const auto iterator = reductions().find(derived); iterator != reductions().end() && !is_predefined(iterator->second.data_type))
+      MPI_CHECK_ERROR_CODE(MPI_Type_free, (&iterator->second.data_type))
+    reductions()[derived] = entry;
+  }
+  static bool                                         is_predefined     (const MPI_Datatype data_type)
+  {
+    std::int32_t integers, addresses, data_types, combiner;
+    MPI_CHECK_ERROR_CODE(MPI_Type_get_envelope, (data_type, &integers, &addresses, &data_types, &combiner))
+    return combiner == MPI_COMBINER_NAMED;
+  }
+
+  template <bool commutative>
+  static MPI_Op                                       reduction_op()
+  {
+    // Not freed, like the key values of cached attributes (see cached_attribute.hpp).
+    static const MPI_Op result = []
+    {
+      MPI_Op op;
+      MPI_CHECK_ERROR_CODE(MPI_Op_create, ([ ] (void* input, void* input_output, std::int32_t* length, MPI_Datatype* data_type)
+      {
+        reduction entry;
+        {
+          std::unique_lock lock(reductions_mutex());
+          entry = reductions().at(*data_type);
+        }
+
+        aint lower_bound, extent, element_extent;
+        MPI_Type_get_extent(*data_type      , &lower_bound, &extent        );
+        MPI_Type_get_extent(entry.data_type , &lower_bound, &element_extent);
+
+        for (std::int32_t i = 0; i < *length; ++i)
+        {
+          const auto element_input        = static_cast<char*>(input       ) + i * extent;
+          const auto element_input_output = static_cast<char*>(input_output) + i * extent;
+          for (count offset = 0; offset < entry.size; offset += large_count_threshold)
+            MPI_Reduce_local(
+              element_input        + offset * element_extent,
+              element_input_output + offset * element_extent,
+              static_cast<std::int32_t>(std::min(large_count_threshold, entry.size - offset)),
+              entry.data_type,
+              entry.op);
+        }
+      }, commutative, &op))
+      return op;
+    } ();
+    return result;
+  }
+
+  std::int32_t size_      = 0;
+  MPI_Datatype data_type_ = MPI_DATATYPE_NULL;
+  MPI_Op       op_        = MPI_OP_NULL;
+  bool         managed_   = false;
+};
+}
\ No newline at end of file
@@ -15,7 +15,8 @@
 
 namespace mpi
 {
-// Given a typename, retrieves the associated MPI data type.
+// Given a typename, retrieves the associated MPI data type. The duplicated and derived data types are deliberately not freed, like the key values of cached
+// attributes (see cached_attribute.hpp).
 template <typename type, typename = void>
 struct type_traits;
 
@@ -74,10 +75,10 @@ struct type_traits<type, std::enable_if_t<std::is_enum_v<type>>>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       return type_traits<std::underlying_type_t<type>>::get_data_type();
-    } ();
+    } ());
     return result;
   }
 };
@@ -109,12 +110,12 @@ struct type_traits<type[size]>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -123,12 +124,12 @@ struct type_traits<type[size_1][size_2]>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size_1 * size_2));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -137,12 +138,12 @@ struct type_traits<type[size_1][size_2][size_3]>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size_1 * size_2 * size_3));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -151,12 +152,12 @@ struct type_traits<type[size_1][size_2][size_3][size_4]>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size_1 * size_2 * size_3 * size_4));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -167,12 +168,12 @@ struct type_traits<std::array<type, size>>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -181,12 +182,12 @@ struct type_traits<std::array<std::array<type, size_2>, size_1>>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size_1 * size_2));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -195,12 +196,12 @@ struct type_traits<std::array<std::array<std::array<type, size_3>, size_2>, size
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size_1 * size_2 * size_3));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -209,12 +210,12 @@ struct type_traits<std::array<std::array<std::array<std::array<type, size_4>, si
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       auto temp = data_type(type_traits<type>::get_data_type(), static_cast<std::int32_t>(size_1 * size_2 * size_3 * size_4));
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -225,7 +226,7 @@ struct type_traits<type>
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       const auto count = std::tuple_size_v<type>;
   
@@ -245,7 +246,7 @@ struct type_traits<type>
       auto temp = data_type(data_types, block_lengths, displacements);
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
@@ -256,7 +257,7 @@ struct type_traits<type, std::enable_if_t<std::conjunction_v<std::negation<is_ar
 {
   static const data_type& get_data_type()
   {
-    static data_type result = []
+    static const data_type& result = *new data_type([]
     {
       const auto count = pfr::tuple_size_v<type>;
   
@@ -276,7 +277,7 @@ struct type_traits<type, std::enable_if_t<std::conjunction_v<std::negation<is_ar
       auto temp = data_type(data_types, block_lengths, displacements);
       temp.commit();
       return std::move(temp);
-    } ();
+    } ());
     return result;
   }
 };
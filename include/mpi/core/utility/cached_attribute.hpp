@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+
+namespace mpi
+{
+// Returns the object of the given type cached as an attribute on the communicator, constructing it from the result of the factory on first use. The object is
+// destroyed along with the native communicator and is not inherited by duplicates.
+//
+// The key value, like the other MPI handles the library holds in function-local statics (e.g. the ops of large counts and aggregates), is deliberately not
+// freed, as static destruction occurs after finalization, when MPI must no longer be called.
+template <typename type, typename factory_type>
+type& cached_attribute(const MPI_Comm communicator, const factory_type& factory)
+{
+  static const std::int32_t key = [ ]
+  {
+    std::int32_t result;
+    MPI_CHECK_ERROR_CODE(MPI_Comm_create_keyval, (MPI_COMM_NULL_COPY_FN, [ ] (MPI_Comm, std::int32_t, void* value, void*)
+    {
+      delete static_cast<type*>(value);
+      return MPI_SUCCESS;
+    }, &result, nullptr))
+    return result;
+  } ();
+
+  void*        value ;
+  std::int32_t exists;
+  MPI_CHECK_ERROR_CODE(MPI_Comm_get_attr, (communicator, key, &value, &exists))
+  if (!static_cast<bool>(exists))
+  {
+    value = new type(factory());
+    MPI_CHECK_ERROR_CODE(MPI_Comm_set_attr, (communicator, key, value))
+  }
+  return *static_cast<type*>(value);
+}
+}
\ No newline at end of file
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <mpi/core/structs/compression_policy.hpp>
+
+// A dependency-free lossless codec for arrays of numbers. Each element is XORed with its predecessor and the bytes are shuffled into planes of equal
+// significance, such that slowly varying data (e.g. smooth fields of doubles, whose neighbors share sign, exponent and leading mantissa bits) yields long
+// runs of zeros in the planes of high significance, which are then run-length encoded. Chunks are compressed independently, hence in parallel, and are
+// stored as is if they do not compress.
+//
+// Layout: header, the compressed size of each chunk, the chunks. Each chunk starts with its mode (stored or encoded).
+namespace mpi
+{
+struct compression_header
+{
+  std::uint64_t size        ;
+  std::uint64_t chunk_size  ;
+  std::uint32_t element_size;
+  std::uint32_t chunk_count ;
+};
+
+namespace detail
+{
+enum class chunk_mode : std::uint8_t
+{
+  stored ,
+  encoded
+};
+
+// Runs of 3 to 130 equal bytes are encoded as a control byte in [128, 255] followed by the byte, sequences of 1 to 128 other bytes as a control byte in
+// [0, 127] followed by the bytes. Returns the end of the encoded data, which requires size + size / 128 + 1 bytes at most.
+inline std::byte* run_length_encode(const std::byte* data, const std::size_t size, std::byte* result)
+{
+  std::size_t literal = 0; // The first byte of the pending literal sequence.
+  std::size_t i       = 0;
+
+  const auto flush = [&] (const std::size_t end)
+  {
+    while (literal < end)
+    {
+      const auto length = std::min<std::size_t>(end - literal, 128);
+      *result++ = static_cast<std::byte>(length - 1);
+      std::memcpy(result, data + literal, length);
+      result  += length;
+      literal += length;
+    }
+  };
+
+  while (i + 2 < size)
+  {
+    if (data[i] != data[i + 1] || data[i] != data[i + 2])
+    {
+      ++i;
+      continue;
+    }
+
+    std::size_t run = 3;
+    while (i + run < size && run < 130 && data[i + run] == data[i])
+      ++run;
+
+    flush(i);
+    *result++ = static_cast<std::byte>(run + 125);
+    *result++ = data[i];
+    i        += run;
+    literal   = i;
+  }
+  flush(size);
+  return result;
+}
+// Returns false if the encoded data is malformed or does not decode to exactly size bytes.
+inline bool run_length_decode(const std::byte* data, const std::size_t size, std::byte* result, const std::size_t result_size)
+{
+  std::size_t i = 0, j = 0;
+  while (i < size)
+  {
+    const auto control = static_cast<std::size_t>(data[i++]);
+    if (control < 128)
+    {
+      const auto length = control + 1;
+      if (i + length > size || j + length > result_size)
+        return false;
+      std::memcpy(result + j, data + i, length);
+      i += length;
+      j += length;
+    }
+    else
+    {
+      const auto length = control - 125;
+      if (i >= size || j + length > result_size)
+        return false;
+      std::fill_n(result + j, length, data[i++]);
+      j += length;
+    }
+  }
+  return j == result_size;
+}
+
+inline void compress_chunk  (const std::byte* data, const std::size_t size, const std::size_t element_size, std::vector<std::byte>& result)
+{
+  const auto             count = size / element_size;
+  std::vector<std::byte> planes(size);
+  if (count > 0)
+    for (std::size_t plane = 0; plane < element_size; ++plane)
+      planes[plane * count] = data[plane];
+  for (std::size_t i = 1; i < count; ++i)
+    for (std::size_t plane = 0; plane < element_size; ++plane)
+      planes[plane * count + i] = data[i * element_size + plane] ^ data[(i - 1) * element_size + plane];
+
+  result.resize(size + size / 128 + 2);
+  result[0] = static_cast<std::byte>(chunk_mode::encoded);
+  result.resize(static_cast<std::size_t>(run_length_encode(planes.data(), planes.size(), result.data() + 1) - result.data()));
+
+  if (result.size() > size + 1)
+  {
+    result.resize(size + 1);
+    result[0] = static_cast<std::byte>(chunk_mode::stored);
+    std::memcpy(result.data() + 1, data, size);
+  }
+}
+inline bool decompress_chunk(const std::byte* data, const std::size_t size, const std::size_t element_size, std::byte* result, const std::size_t result_size)
+{
+  if (size == 0)
+    return false;
+
+  if (static_cast<chunk_mode>(data[0]) == chunk_mode::stored)
+  {
+    if (size - 1 != result_size)
+      return false;
+    std::memcpy(result, data + 1, result_size);
+    return true;
+  }
+
+  std::vector<std::byte> planes(result_size);
+  if (!run_length_decode(data + 1, size - 1, planes.data(), result_size))
+    return false;
+
+  const auto count = result_size / element_size;
+  for (std::size_t plane = 0; plane < element_size; ++plane)
+  {
+    const auto input    = planes.data() + plane * count;
+    std::byte  previous {0};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      previous                         ^= input[i];
+      result[i * element_size + plane]  = previous;
+    }
+  }
+  return true;
+}
+
+// Invokes the function for each index in [0, size) using up to thread_count threads.
+template <typename function_type>
+void parallel_for(const std::size_t size, std::int32_t thread_count, const function_type& function)
+{
+  if (thread_count <= 0)
+    thread_count = static_cast<std::int32_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  const auto threads = std::min(static_cast<std::size_t>(thread_count), size);
+
+  if (threads <= 1)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      function(i);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (std::size_t thread = 1; thread < threads; ++thread)
+    workers.emplace_back([&, thread]
+    {
+      for (auto i = thread; i < size; i += threads)
+        function(i);
+    });
+  for (std::size_t i = 0; i < size; i += threads)
+    function(i);
+  for (auto& worker : workers)
+    worker.join();
+}
+}
+
+// Transfers below the threshold of the policy are stored as a single chunk without encoding. The size must be a multiple of the element size.
+inline std::vector<std::byte> compress       (const std::span<const std::byte> data, std::size_t element_size, const compression_policy& policy = {})
+{
+  if (element_size == 0 || data.size() % element_size != 0)
+    element_size = 1;
+
+  const auto encoded     = data.size() >= policy.threshold;
+  const auto chunk_size  = encoded ? std::max(policy.chunk_size / element_size, std::size_t(1)) * element_size : std::max(data.size(), std::size_t(1));
+  const auto chunk_count = (data.size() + chunk_size - 1) / chunk_size;
+
+  std::vector<std::vector<std::byte>> chunks(chunk_count);
+  detail::parallel_for(chunk_count, encoded ? policy.thread_count : 1, [&] (const std::size_t i)
+  {
+    const auto offset = i * chunk_size;
+    const auto size   = std::min(chunk_size, data.size() - offset);
+    if (encoded)
+      detail::compress_chunk(data.data() + offset, size, element_size, chunks[i]);
+    else
+    {
+      chunks[i].resize(size + 1);
+      chunks[i][0] = static_cast<std::byte>(detail::chunk_mode::stored);
+      std::memcpy(chunks[i].data() + 1, data.data() + offset, size);
+    }
+  });
+
+  const compression_header header {data.size(), chunk_size, static_cast<std::uint32_t>(element_size), static_cast<std::uint32_t>(chunk_count)};
+  std::vector<std::uint64_t> sizes(chunk_count);
+  std::size_t                total = sizeof(header) + chunk_count * sizeof(std::uint64_t);
+  for (std::size_t i = 0; i < chunk_count; ++i)
+    total += sizes[i] = chunks[i].size();
+
+  std::vector<std::byte> result(total);
+  auto                   output = result.data();
+  std::memcpy(output, &header     , sizeof(header));                       output += sizeof(header);
+  std::memcpy(output, sizes.data(), chunk_count * sizeof(std::uint64_t)); output += chunk_count * sizeof(std::uint64_t);
+  for (const auto& chunk : chunks)
+  {
+    std::memcpy(output, chunk.data(), chunk.size());
+    output += chunk.size();
+  }
+  return result;
+}
+
+// Returns the number of bytes the compressed data decompresses to, or zero if it is malformed.
+inline std::size_t            decompressed_size(const std::span<const std::byte> data)
+{
+  if (data.size() < sizeof(compression_header))
+    return 0;
+  compression_header header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  return static_cast<std::size_t>(header.size);
+}
+// The result must hold decompressed_size(data) bytes. Returns false if the compressed data is malformed.
+inline bool                   decompress     (const std::span<const std::byte> data, std::byte* result, const std::size_t result_size, const compression_policy& policy = {})
+{
+  if (data.size() < sizeof(compression_header))
+    return false;
+
+  compression_header header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  const auto table = sizeof(header) + std::size_t(header.chunk_count) * sizeof(std::uint64_t);
+  if (header.size != result_size || header.element_size == 0 || header.chunk_size == 0 || data.size() < table ||
+      header.chunk_count != (header.size + header.chunk_size - 1) / header.chunk_size)
+    return false;
+
+  std::vector<std::uint64_t> sizes  (header.chunk_count);
+  std::vector<std::size_t>   offsets(header.chunk_count);
+  std::memcpy(sizes.data(), data.data() + sizeof(header), sizes.size() * sizeof(std::uint64_t));
+  auto offset = table;
+  for (std::size_t i = 0; i < sizes.size(); ++i)
+  {
+    offsets[i] = offset;
+    offset    += sizes[i];
+  }
+  if (offset != data.size())
+    return false;
+
+  std::vector<char> valid(header.chunk_count, 1);
+  detail::parallel_for(header.chunk_count, header.chunk_count > 1 ? policy.thread_count : 1, [&] (const std::size_t i)
+  {
+    const auto output = i * header.chunk_size;
+    const auto size   = std::min<std::size_t>(header.chunk_size, header.size - output);
+    valid[i] = detail::decompress_chunk(data.data() + offsets[i], sizes[i], header.element_size, result + output, size);
+  });
+  return std::ranges::all_of(valid, [ ] (const char value) { return value != 0; });
+}
+}
\ No newline at end of file
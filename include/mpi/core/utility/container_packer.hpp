@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/type/compliant_container_traits.hpp>
+#include <mpi/core/type/type_traits.hpp>
+#include <mpi/core/utility/tuple_traits.hpp>
+
+// Non-contiguous sequential containers (std::deque, std::forward_list, std::list, std::vector<bool>) and associative containers do not expose a buffer.
+// Container packers copy their elements into a contiguous scratch buffer prior to sending, and copy them back out of it after receiving.
+// The scratch buffers are pooled per thread, hence repeated transfers do not allocate once the pool has grown to the largest transfer.
+namespace mpi
+{
+template <typename type>
+concept packable_container = compliant_non_contiguous_sequential_container<type> || compliant_associative_container<type>;
+
+// The keys of associative containers are const, which would prevent receiving into them.
+template <typename value_type>
+struct packed_value_type                           { using type = value_type; };
+template <typename first, typename second>
+struct packed_value_type<std::pair<first, second>> { using type = std::pair<std::remove_const_t<first>, second>; };
+
+template <packable_container type>
+class container_packer
+{
+public:
+  using value_type = typename packed_value_type<typename type::value_type>::type;
+
+  static_assert(std::is_trivially_destructible_v<value_type>, "Packed elements must be trivially destructible.");
+
+  explicit container_packer  (const type& container)
+  : buffer_(acquire())
+  {
+    reserve(static_cast<std::size_t>(std::distance(container.begin(), container.end())));
+
+    auto iterator = data();
+    for (const auto& element : container)
+      ::new (static_cast<void*>(iterator++)) value_type(element);
+  }
+  explicit container_packer  (const std::size_t size)
+  : buffer_(acquire())
+  {
+    reserve(size);
+    std::uninitialized_value_construct_n(data(), size_);
+  }
+  container_packer           (const container_packer&  that) = delete;
+  container_packer           (      container_packer&& temp) = delete;
+  virtual ~container_packer  ()
+  {
+    // Growing the pool may throw, in which case the buffer is released rather than pooled.
+    try
+    {
+      pool().push_back(std::move(buffer_));
+    }
+    catch (...)
+    {
+
+    }
+  }
+  container_packer& operator=(const container_packer&  that) = delete;
+  container_packer& operator=(      container_packer&& temp) = delete;
+
+  static const mpi::data_type& data_type()
+  {
+    return type_traits<value_type>::get_data_type();
+  }
+
+  [[nodiscard]]
+  value_type*                  data     ()
+  {
+    return std::launder(reinterpret_cast<value_type*>(buffer_.data()));
+  }
+  [[nodiscard]]
+  const value_type*            data     () const
+  {
+    return std::launder(reinterpret_cast<const value_type*>(buffer_.data()));
+  }
+  [[nodiscard]]
+  std::size_t                  size     () const
+  {
+    return size_;
+  }
+
+  void                         unpack   (type& container) const
+  {
+    if constexpr (compliant_associative_container<type>)
+    {
+      container.clear ();
+      container.insert(data(), data() + size_);
+    }
+    else
+      container.assign(data(), data() + size_);
+  }
+
+protected:
+  static std::vector<std::vector<std::byte>>& pool   ()
+  {
+    thread_local std::vector<std::vector<std::byte>> result;
+    return result;
+  }
+  static std::vector<std::byte>               acquire()
+  {
+    if (pool().empty())
+      return {};
+
+    auto result = std::move(pool().back());
+    pool().pop_back();
+    return result;
+  }
+
+  void                                        reserve(const std::size_t size)
+  {
+    static_assert(alignof(value_type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Packed elements must not be over-aligned.");
+
+    size_ = size;
+    if (buffer_.size() < size_ * sizeof(value_type))
+      buffer_.resize(size_ * sizeof(value_type));
+  }
+
+  std::vector<std::byte> buffer_;
+  std::size_t            size_ = 0;
+};
+}
\ No newline at end of file
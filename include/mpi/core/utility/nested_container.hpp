@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <mpi/core/type/compliant_container_traits.hpp>
+#include <mpi/core/type/data_type.hpp>
+#include <mpi/core/type/type_traits.hpp>
+#include <mpi/core/utility/sequential_container_traits.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+
+// Nested containers (e.g. std::vector<std::vector<type>>, std::vector<std::string>) are exchanged in compressed sparse row layout, consisting of the lengths
+// of the inner containers followed by their elements. The sending side describes the lengths and the inner containers in place through a data type over their
+// absolute addresses, the receiving side gathers the lengths and elements of all processes into one buffer each before rebuilding the nested container.
+namespace mpi
+{
+template <typename type>
+concept nested_container = contiguous_sequential_container<type> && compliant_contiguous_sequential_container<typename type::value_type> &&
+  requires (type& container, typename type::value_type& inner, const typename type::value_type::value_type* data)
+  {
+    container.resize(std::size_t());
+    inner    .assign(data, data);
+  };
+
+// Blocks of a struct data type over absolute addresses, to be used with MPI_BOTTOM. Empty blocks are omitted.
+class address_blocks
+{
+public:
+  explicit address_blocks(const std::size_t capacity)
+  {
+    // Reserved in advance, as copying the data types would duplicate them.
+    data_types_   .reserve(capacity);
+    block_lengths_.reserve(capacity);
+    displacements_.reserve(capacity);
+  }
+
+  void           append   (const void* data, const count size, const mpi::data_type& data_type)
+  {
+    if (size == 0)
+      return;
+
+    aint address;
+    MPI_CHECK_ERROR_CODE(MPI_Get_address, (data, &address))
+    data_types_   .emplace_back(data_type.native());
+    block_lengths_.push_back   (static_cast<std::int32_t>(size));
+    displacements_.push_back   (address);
+  }
+
+  [[nodiscard]]
+  mpi::data_type data_type() const
+  {
+    auto result = mpi::data_type(data_types_, block_lengths_, displacements_);
+    result.commit();
+    return result;
+  }
+
+protected:
+  std::vector<mpi::data_type> data_types_   ;
+  std::vector<std::int32_t>   block_lengths_;
+  std::vector<aint>           displacements_;
+};
+
+template <nested_container type>
+class nested_sender
+{
+public:
+  using value_type = typename type::value_type::value_type;
+
+  explicit nested_sender (const type& container)
+  : container_(container), lengths_(container.size()), offsets_(container.size() + 1, 0)
+  {
+    for (std::size_t i = 0; i < container_.size(); ++i)
+    {
+      lengths_[i]     = static_cast<count>(container_[i].size());
+      offsets_[i + 1] = offsets_[i] + lengths_[i];
+    }
+  }
+
+  [[nodiscard]]
+  count          size         () const
+  {
+    return static_cast<count>(lengths_.size());
+  }
+  [[nodiscard]]
+  count          element_count(const std::size_t first, const std::size_t last) const
+  {
+    return offsets_[last] - offsets_[first];
+  }
+
+  // Describes the lengths of the inner containers [first, last), followed by their elements.
+  [[nodiscard]]
+  mpi::data_type data_type    (const std::size_t first, const std::size_t last) const
+  {
+    address_blocks blocks(last - first + 1);
+    blocks.append(lengths_.data() + first, static_cast<count>(last - first), type_traits<count>::get_data_type());
+    for (auto i = first; i < last; ++i)
+      blocks.append(container_[i].data(), lengths_[i], type_traits<value_type>::get_data_type());
+
+    return blocks.data_type();
+  }
+
+protected:
+  const type&        container_;
+  std::vector<count> lengths_  ;
+  std::vector<count> offsets_  ;
+};
+
+template <nested_container type>
+class nested_receiver
+{
+public:
+  using value_type = typename type::value_type::value_type;
+
+  // The sizes contain the number of inner containers and elements received from each process, interleaved.
+  explicit nested_receiver(const std::vector<count>& sizes)
+  : length_offsets_(sizes.size() / 2 + 1, 0), value_offsets_(sizes.size() / 2 + 1, 0)
+  {
+    for (std::size_t i = 0; i < sizes.size() / 2; ++i)
+    {
+      length_offsets_[i + 1] = length_offsets_[i] + sizes[2 * i    ];
+      value_offsets_ [i + 1] = value_offsets_ [i] + sizes[2 * i + 1];
+    }
+
+    lengths_.resize(static_cast<std::size_t>(length_offsets_.back()));
+    values_ .resize(static_cast<std::size_t>(value_offsets_ .back()));
+  }
+
+  // Describes the lengths and elements received from the given process.
+  [[nodiscard]]
+  mpi::data_type data_type(const std::size_t process)
+  {
+    address_blocks blocks(2);
+    blocks.append(lengths_.data() + length_offsets_[process], length_offsets_[process + 1] - length_offsets_[process], type_traits<count     >::get_data_type());
+    blocks.append(values_ .data() + value_offsets_ [process], value_offsets_ [process + 1] - value_offsets_ [process], type_traits<value_type>::get_data_type());
+
+    return blocks.data_type();
+  }
+
+  void           unpack   (type& container) const
+  {
+    container.resize(lengths_.size());
+
+    auto iterator = values_.data();
+    for (std::size_t i = 0; i < lengths_.size(); ++i)
+    {
+      container[i].assign(iterator, iterator + lengths_[i]);
+      iterator += lengths_[i];
+    }
+  }
+
+protected:
+  std::vector<count>      lengths_       ;
+  std::vector<value_type> values_        ;
+  std::vector<count>      length_offsets_;
+  std::vector<count>      value_offsets_ ;
+};
+}
\ No newline at end of file
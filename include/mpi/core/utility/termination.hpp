@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/type/standard_data_types.hpp>
+#include <mpi/core/standard_ops.hpp>
+
+namespace mpi::detail
+{
+// Collective. Calls progress until every message sent by any process to this one has been received, including those sent by progress itself in the meantime.
+// Each round compares the messages sent to each process with those it received. The exchange is complete once a round finds that no process has sent further
+// messages since the comparison, as the messages received can not exceed the messages sent. Hence progress must not leave messages buffered but unsent.
+template <typename progress_type>
+void synchronize_message_counts(const communicator& communicator, const std::vector<std::uint64_t>& sent_counts, const std::uint64_t& received_count, const progress_type& progress)
+{
+  const std::vector<std::int32_t> sizes(sent_counts.size(), 1);
+  while (true)
+  {
+    const auto    snapshot = sent_counts;
+    std::uint64_t expected = 0;
+    communicator.reduce_scatter(snapshot.data(), &expected, sizes, data_types::uint64_t, ops::sum);
+    while (received_count < expected)
+      progress();
+
+    bool complete = snapshot == sent_counts;
+    communicator.all_reduce(complete, ops::logical_and);
+    if (complete)
+      break;
+  }
+}
+}
\ No newline at end of file
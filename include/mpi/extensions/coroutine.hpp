@@ -0,0 +1,354 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/request.hpp>
+#include <mpi/core/status.hpp>
+
+// Requests are awaitable within tasks, e.g. co_await communicator.immediate_receive(data, source), which suspends the task until the request completes. The
+// tasks are run by a request scheduler, which tests all outstanding requests of its tasks through a single MPI_Testsome per poll and resumes the tasks whose
+// requests completed. Thousands of independent operations hence overlap on a single thread, without a thread per operation or manual state machines.
+//
+// Awaiting a request takes ownership of it (persistent requests excepted, which remain with the caller and must have been started). Tasks are lazy: they
+// start once spawned on a scheduler or awaited by another task, which they then inherit the scheduler of.
+namespace mpi
+{
+class request_scheduler;
+
+template <typename type = void>
+class task;
+
+namespace detail
+{
+struct task_promise_base
+{
+  struct final_awaiter
+  {
+    [[nodiscard]]
+    bool                    await_ready  () const noexcept
+    {
+      return false;
+    }
+    template <typename promise_type>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+    {
+      const auto continuation = handle.promise().continuation;
+      return continuation ? continuation : std::noop_coroutine();
+    }
+    void                    await_resume () const noexcept
+    {
+
+    }
+  };
+
+  [[nodiscard]]
+  std::suspend_always initial_suspend    () const noexcept
+  {
+    return {};
+  }
+  [[nodiscard]]
+  final_awaiter       final_suspend      () const noexcept
+  {
+    return {};
+  }
+  void                unhandled_exception()
+  {
+    exception = std::current_exception();
+  }
+
+  request_scheduler*      scheduler    = nullptr;
+  std::coroutine_handle<> continuation ;
+  std::exception_ptr      exception    ;
+};
+
+template <typename type>
+struct task_promise : task_promise_base
+{
+  task<type> get_return_object() noexcept;
+  void       return_value     (type value)
+  {
+    result.emplace(std::move(value));
+  }
+
+  std::optional<type> result;
+};
+template <>
+struct task_promise<void> : task_promise_base
+{
+  task<void> get_return_object() noexcept;
+  void       return_void      () const noexcept
+  {
+
+  }
+};
+}
+
+template <typename type>
+class task
+{
+public:
+  using promise_type = detail::task_promise<type>;
+
+  explicit task  (const std::coroutine_handle<promise_type> handle) noexcept
+  : handle_(handle)
+  {
+
+  }
+  task           (const task&  that) = delete;
+  task           (      task&& temp) noexcept
+  : handle_(std::exchange(temp.handle_, nullptr))
+  {
+
+  }
+  virtual ~task  ()
+  {
+    if (handle_)
+      handle_.destroy();
+  }
+  task& operator=(const task&  that) = delete;
+  task& operator=(      task&& temp) noexcept
+  {
+    if (this != &temp)
+    {
+      if (handle_)
+        handle_.destroy();
+      handle_ = std::exchange(temp.handle_, nullptr);
+    }
+    return *this;
+  }
+
+  [[nodiscard]]
+  bool done() const noexcept
+  {
+    return !handle_ || handle_.done();
+  }
+
+  struct awaiter;
+
+  // Starts the task within the awaiting one, on the scheduler of the awaiting one.
+  awaiter operator co_await() && noexcept
+  {
+    return awaiter {handle_};
+  }
+
+protected:
+  friend class request_scheduler;
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+template <typename type>
+struct task<type>::awaiter
+{
+  [[nodiscard]]
+  bool                    await_ready  () const noexcept
+  {
+    return !handle || handle.done();
+  }
+  template <typename awaiting_promise_type>
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<awaiting_promise_type> awaiting) const noexcept
+  {
+    handle.promise().scheduler    = awaiting.promise().scheduler;
+    handle.promise().continuation = awaiting;
+    return handle;
+  }
+  type                    await_resume () const
+  {
+    if (handle.promise().exception)
+      std::rethrow_exception(handle.promise().exception);
+    if constexpr (!std::is_void_v<type>)
+      return std::move(*handle.promise().result);
+  }
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+template <typename type>
+task<type> detail::task_promise<type>::get_return_object() noexcept
+{
+  return task<type>(std::coroutine_handle<task_promise>::from_promise(*this));
+}
+inline task<void> detail::task_promise<void>::get_return_object() noexcept
+{
+  return task<void>(std::coroutine_handle<task_promise>::from_promise(*this));
+}
+
+class request_scheduler
+{
+public:
+  explicit request_scheduler  (const std::size_t capacity = 0)
+  {
+    natives_  .reserve(capacity);
+    waiters_  .reserve(capacity);
+    statuses_ .reserve(capacity);
+    indices_  .reserve(capacity);
+    completed_.reserve(capacity);
+  }
+  request_scheduler           (const request_scheduler&  that) = delete ;
+  request_scheduler           (      request_scheduler&& temp) = delete ;
+  // The outstanding requests must have completed, i.e. run() must have returned.
+  virtual ~request_scheduler  ()
+  {
+    for (auto& task : tasks_)
+      task.handle.destroy();
+  }
+  request_scheduler& operator=(const request_scheduler&  that) = delete ;
+  request_scheduler& operator=(      request_scheduler&& temp) = delete ;
+
+  // Takes ownership of the task, which starts on the next poll.
+  template <typename type>
+  void        spawn  (task<type>&& task)
+  {
+    auto handle = std::exchange(task.handle_, nullptr);
+    handle.promise().scheduler = this;
+    tasks_.push_back({handle, &handle.promise()});
+    ready_.push_back(handle);
+  }
+
+  // Resumes the spawned tasks which have not started, then tests all outstanding requests once and resumes the tasks whose requests completed. Rethrows the
+  // first exception escaping a spawned task.
+  void        poll   ()
+  {
+    for (std::size_t i = 0; i < ready_.size(); ++i) // Tasks may spawn further tasks, hence the handle is copied.
+    {
+      const auto handle = ready_[i];
+      handle.resume();
+    }
+    ready_.clear();
+
+    if (!natives_.empty())
+    {
+      std::int32_t count(0);
+      statuses_.resize(natives_.size());
+      indices_ .resize(natives_.size());
+      MPI_CHECK_ERROR_CODE(MPI_Testsome, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &count, indices_.data(), statuses_.data()))
+
+      if (count != MPI_UNDEFINED && count > 0)
+      {
+        // The completed requests are removed before resuming, as the resumed tasks may await further requests.
+        completed_.clear();
+        for (std::int32_t i = 0; i < count; ++i)
+        {
+          auto& waiter = waiters_[indices_[i]];
+          *waiter.result = status(statuses_[i]);
+          completed_.push_back(waiter.handle);
+          waiter.handle  = nullptr;
+        }
+
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < natives_.size(); ++i)
+          if (waiters_[i].handle)
+          {
+            natives_[size] = natives_[i];
+            waiters_[size] = waiters_[i];
+            ++size;
+          }
+        natives_.resize(size);
+        waiters_.resize(size);
+
+        for (const auto handle : completed_)
+          handle.resume();
+      }
+    }
+
+    std::exception_ptr exception;
+    std::erase_if(tasks_, [&] (const spawned_task& task)
+    {
+      if (!task.handle.done())
+        return false;
+      if (!exception)
+        exception = task.promise->exception;
+      task.handle.destroy();
+      return true;
+    });
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+  // Polls until all spawned tasks have completed.
+  void        run    ()
+  {
+    while (!tasks_.empty())
+      poll();
+  }
+
+  [[nodiscard]]
+  std::size_t pending() const
+  {
+    return natives_.size();
+  }
+
+  // Suspends the task until the request completes, upon which the status is stored in the result.
+  void        enqueue(request& request, const std::coroutine_handle<> handle, status* result)
+  {
+    natives_.push_back(request.native_);
+    waiters_.push_back({handle, result});
+    if (!request.persistent_) // Completion frees the request, hence the scheduler takes ownership.
+    {
+      request.managed_ = false;
+      request.native_  = MPI_REQUEST_NULL;
+    }
+  }
+
+protected:
+  struct waiter
+  {
+    std::coroutine_handle<> handle;
+    status*                 result;
+  };
+  struct spawned_task
+  {
+    std::coroutine_handle<>    handle ;
+    detail::task_promise_base* promise;
+  };
+
+  std::vector<MPI_Request>             natives_  ;
+  std::vector<waiter>                  waiters_  ;
+  std::vector<MPI_Status>              statuses_ ;
+  std::vector<std::int32_t>            indices_  ;
+  std::vector<std::coroutine_handle<>> completed_;
+  std::vector<std::coroutine_handle<>> ready_    ;
+  std::vector<spawned_task>            tasks_    ;
+};
+
+// Suspends the awaiting task until the request completes, and returns its status. Awaiting a temporary request stores it within the awaiter.
+template <typename request_type>
+struct request_awaiter
+{
+  [[nodiscard]]
+  bool   await_ready  () const noexcept
+  {
+    return request.native() == MPI_REQUEST_NULL;
+  }
+  template <typename promise_type>
+  void   await_suspend(std::coroutine_handle<promise_type> handle)
+  {
+    handle.promise().scheduler->enqueue(request, handle, &result);
+  }
+  [[nodiscard]]
+  status await_resume () const noexcept
+  {
+    return result;
+  }
+
+  request_type request;
+  status       result {};
+};
+
+inline request_awaiter<request&> operator co_await(request&  request)
+{
+  return {request};
+}
+inline request_awaiter<request > operator co_await(request&& request)
+{
+  return {std::move(request)};
+}
+}
\ No newline at end of file
@@ -1,17 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
-#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <list>
 #include <mutex>
+#include <new>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include <mpi/core/structs/execution_hint.hpp>
+#include <mpi/core/structs/progress_policy.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/mpi.hpp>
 #include <mpi/core/request.hpp>
 #include <mpi/core/status.hpp>
+#include <mpi/extensions/thread_pool.hpp>
 
 // This is a C++20 implementation of https://github.com/RWTH-HPC/mpi-detach with several modifications:
 // - Use RAII for initialization and finalization.
@@ -21,6 +31,11 @@
 // - Use mpi::status   instead of MPI_Status .
 // - Use std::function instead of function pointers.
 // - Use captures      instead of void* argument.
+// - Detached requests are submitted through a lock-free queue, and tested through a single MPI_Testsome over contiguous arrays per sweep.
+// - The states of detached requests are pooled.
+// - The progress thread backs off adaptively (see progress_policy.hpp) instead of sleeping a fixed duration per sweep.
+// - Callbacks are optionally dispatched to a work-stealing thread pool (see thread_pool.hpp), such that the progress thread only polls MPI. Callbacks calling
+//   MPI from the pool then require thread_support::multiple.
 namespace mpi
 {
 class detach_context
@@ -29,193 +44,356 @@ public:
   using detach_function     = std::function<void(const status&)>;
   using detach_all_function = std::function<void(const std::vector<status>&)>;
 
-  struct detach_state
-  {
-    detach_state(mpi::request& req, detach_function func)
-    : request (req.persistent() ? mpi::request(req.native(), false, true) : std::move(req)) // If persistent create an unmanaged copy, else move.
-    , function(std::move(func))
-    {
-
-    }
-  
-    mpi::request    request ;
-    detach_function function;
-    mpi::status     status  ;
-  };
-  struct detach_all_state
-  {
-    detach_all_state(std::vector<request>& reqs, detach_all_function func)
-    : function(std::move(func))
-    , stati   (reqs.size())
-    {
-      requests.reserve(reqs.size());
-      for (auto& req : reqs)
-        requests.push_back(req.persistent() ? request(req.native(), false, true) : std::move(req)); // If persistent create an unmanaged copy, else move.
-    }
-  
-    std::vector<request> requests;
-    detach_all_function  function;
-    std::vector<status>  stati   ;
-  };
-
-  explicit detach_context  (const bool create_progress_thread = true)
-  : running_(true)
+  // Callbacks are invoked by the progressing thread if the executor thread count is zero, and by an owned thread pool of the given size otherwise.
+  explicit detach_context  (const bool create_progress_thread = true, const progress_policy& policy = {}, const std::size_t executor_thread_count = 0)
+  : policy_(policy)
   {
+    if (executor_thread_count > 0)
+      executor_.emplace(executor_thread_count);
     if (create_progress_thread)
-      progress_thread_ = std::thread([&]
-      {
-        while (running_ || !single_requests_.empty() || !all_requests_.empty())
-        {
-          do
-          {
-            std::unique_lock lock(list_mutex_);
-
-            if (!single_requests_queue_.empty())
-              single_requests_.splice(single_requests_.begin(), single_requests_queue_);
-
-            if (!all_requests_queue_.empty())
-              all_requests_   .splice(all_requests_   .begin(), all_requests_queue_   );
-
-            if (single_requests_.empty() && all_requests_.empty())
-              while (running_ && single_requests_queue_.empty() && all_requests_queue_.empty())
-              {
-                list_condition_variable_.wait(lock);
-              }
-          } while (running_ && single_requests_.empty() && all_requests_.empty());
-
-          progress();
-
-          std::this_thread::sleep_for(std::chrono::milliseconds(2));
-        }
-      });
+      progress_thread_ = std::thread([&] { run(); });
   }
   detach_context           (const detach_context&  that) = delete;
   detach_context           (      detach_context&& temp) = delete;
+  // Blocks until the callbacks of all detached requests have been invoked.
   virtual ~detach_context  ()
   {
     if (progress_thread_)
     {
-      {
-        std::unique_lock lock(list_mutex_);
-        while (!single_requests_queue_.empty() || !all_requests_queue_.empty()) 
-        {
-          list_condition_variable_.notify_one();
-          lock.unlock();
-          std::this_thread::sleep_for(std::chrono::milliseconds(2));
-          lock.lock  ();
-        }
-        running_ = false;
-        list_condition_variable_.notify_one();
-      }
+      running_ = false;
+      submissions_.fetch_add (1, std::memory_order_release);
+      submissions_.notify_one();
       progress_thread_->join();
     }
     else
     {
-      while (!single_requests_queue_.empty() || 
-             !single_requests_      .empty() || 
-             !all_requests_queue_   .empty() ||
-             !all_requests_         .empty())
+      while (outstanding_.load(std::memory_order_acquire) > 0)
         progress();
     }
+
+    for (auto& chunk : chunks_)
+      delete[] chunk.load(std::memory_order_relaxed);
   }
   detach_context& operator=(const detach_context&  that) = delete;
   detach_context& operator=(      detach_context&& temp) = delete;
 
-  void progress            ()
+  // Tests all detached requests once and invokes (or dispatches to the executor) the callbacks of the completed ones. Returns the number of callbacks invoked
+  // or dispatched, which is zero if another thread is progressing concurrently.
+  std::size_t progress     ()
   {
-    if (!progress_mutex_.try_lock())
-      return;
+    if (progressing_.test_and_set(std::memory_order_acquire))
+      return 0;
 
+    // The submissions are pushed onto a stack, hence are reversed into submission order.
+    auto submitted = submitted_.exchange(nullptr, std::memory_order_acquire);
+    state* ordered = nullptr;
+    while (submitted)
+      ordered = std::exchange(submitted, std::exchange(submitted->next, ordered));
+    for (; ordered; ordered = ordered->next)
     {
-      std::unique_lock lock(list_mutex_);
-
-      if (!single_requests_queue_.empty())
-        single_requests_.splice(single_requests_.begin(), single_requests_queue_);
-
-      if (!all_requests_queue_.empty())
-        all_requests_   .splice(all_requests_   .begin(), all_requests_queue_   );
+      ordered->remaining = ordered->natives.size();
+      if (ordered->remaining == 0)
+        completed_.push_back(ordered);
+      for (std::size_t i = 0; i < ordered->natives.size(); ++i)
+      {
+        natives_.push_back(ordered->natives  [i]);
+        entries_.push_back({ordered, ordered->positions[i]});
+      }
     }
 
-    if (!single_requests_.empty()) 
+    if (!natives_.empty())
     {
-      auto   iterator  = single_requests_.begin();
-      while (iterator != single_requests_.end  ())
+      std::int32_t count;
+      statuses_.resize(natives_.size());
+      indices_ .resize(natives_.size());
+      MPI_CHECK_ERROR_CODE(MPI_Testsome, (static_cast<std::int32_t>(natives_.size()), natives_.data(), &count, indices_.data(), statuses_.data()))
+
+      if (count != MPI_UNDEFINED && count > 0)
       {
-        if ([[maybe_unused]] auto status = (*iterator)->request.test())
+        for (std::int32_t i = 0; i < count; ++i)
         {
-          (*iterator)->function((*iterator)->status);
-          delete *iterator;
-          iterator = single_requests_.erase(iterator);
+          auto& entry = entries_[indices_[i]];
+          entry.owner->statuses[entry.position] = status(statuses_[i]);
+          if (--entry.owner->remaining == 0)
+            completed_.push_back(entry.owner);
+          entry.owner = nullptr;
         }
-        else 
-          ++iterator;
+
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < natives_.size(); ++i)
+          if (entries_[i].owner)
+          {
+            natives_[size] = natives_[i];
+            entries_[size] = entries_[i];
+            ++size;
+          }
+        natives_.resize(size);
+        entries_.resize(size);
       }
     }
-    if (!all_requests_   .empty()) 
+
+    // The callbacks may detach further requests, which are collected on the next sweep.
+    const auto result = completed_.size();
+    for (const auto state : completed_)
     {
-      auto   iterator  = all_requests_.begin();
-      while (iterator != all_requests_.end  ()) 
-      {
-        if (auto status = test_all((*iterator)->requests))
-        {
-          (*iterator)->function((*iterator)->stati);
-          delete *iterator;
-          iterator = all_requests_.erase(iterator);
-        }
-        else
-          ++iterator;
-      }
+      if (executor_)
+        executor_->submit([this, state] { invoke(state); }, state->hint);
+      else
+        invoke(state);
     }
+    completed_.clear();
 
-    progress_mutex_.unlock();
+    progressing_.clear(std::memory_order_release);
+    return result;
   }
-  void detach              (request&              request , const detach_function&     callback)
+
+  // Requests which have already completed invoke the callback immediately on the calling thread (or dispatch it to the executor).
+  void        detach       (request&              request , const detach_function&     callback, const execution_hint& hint = {})
   {
-    if (const auto status = request.test()) 
-      callback(*status);
-    else 
+    if (const auto status = request.test())
     {
-      std::unique_lock lock(list_mutex_);
-      single_requests_queue_    .push_back (new detach_state(request, callback));
-      list_condition_variable_  .notify_one();
+      if (executor_)
+        dispatch([callback, status = *status] { callback(status); }, hint);
+      else
+        callback(*status);
+    }
+    else
+    {
+      const auto state = acquire();
+      state->function  = callback;
+      state->hint      = hint;
+      state->statuses.resize(1);
+      take  (state, request, 0);
+      submit(state);
     }
   }
-  void detach_each         (std::vector<request>& requests, const detach_function&     callback)
+  void        detach_each  (std::vector<request>& requests, const detach_function&     callback, const execution_hint& hint = {})
   {
     for (auto& request : requests)
+      detach(request, callback, hint);
+  }
+  void        detach_all   (std::vector<request>& requests, const detach_all_function& callback, const execution_hint& hint = {})
+  {
+    if (auto stati = test_all(requests))
     {
-      if (auto status = request.test())
-        callback(*status);
-      else 
+      if (executor_)
+        dispatch([callback, stati = std::move(*stati)] { callback(stati); }, hint);
+      else
+        callback(*stati);
+    }
+    else
+    {
+      const auto state      = acquire();
+      state->all_function   = callback;
+      state->hint           = hint;
+      state->statuses.resize(requests.size());
+      for (std::size_t i = 0; i < requests.size(); ++i)
+        take(state, requests[i], i);
+      submit(state);
+    }
+  }
+
+  // The number of detached requests (or groups of requests detached together) whose callbacks have not been invoked yet.
+  [[nodiscard]]
+  std::size_t outstanding  () const
+  {
+    return outstanding_.load(std::memory_order_acquire);
+  }
+
+protected:
+  // The state of a request, or of a group of requests detached together.
+  struct state
+  {
+    std::vector<MPI_Request>   natives      ;
+    std::vector<std::size_t>   positions    ; // Of the natives within the statuses.
+    std::vector<status>        statuses     ;
+    detach_function            function     ;
+    detach_all_function        all_function ;
+    execution_hint             hint         ;
+    std::size_t                remaining    = 0;
+    state*                     next         = nullptr; // Within the submission queue.
+    std::atomic<std::uint32_t> next_free    = 0;       // Within the pool, as an index offset by one.
+    std::uint32_t              index        = 0;       // Within the pool.
+  };
+  struct entry
+  {
+    state*      owner   ;
+    std::size_t position;
+  };
+
+  static constexpr std::uint32_t chunk_base  = 64;
+  static constexpr std::uint64_t index_mask  = 0xFFFFFFFF;
+
+  // The pool is a stack of indices with a tag counting the operations in the upper half, which prevents a pop from succeeding on a stale head (ABA). The
+  // states are stored in chunks of doubling size which are never freed before destruction, hence stale states may be read safely.
+  [[nodiscard]]
+  state*      at           (const std::uint32_t index) const
+  {
+    const auto chunk  = std::bit_width(index / chunk_base + 1) - 1;
+    const auto offset = index - chunk_base * ((std::uint32_t(1) << chunk) - 1);
+    return chunks_[chunk].load(std::memory_order_acquire) + offset;
+  }
+  state*      acquire      ()
+  {
+    auto head = free_.load(std::memory_order_acquire);
+    while (true)
+    {
+      if ((head & index_mask) == 0)
       {
-        std::unique_lock lock(list_mutex_);
-        single_requests_queue_  .push_back (new detach_state(request, callback));
-        list_condition_variable_.notify_one();
+        grow();
+        head = free_.load(std::memory_order_acquire);
+        continue;
       }
+
+      const auto state = at(static_cast<std::uint32_t>(head & index_mask) - 1);
+      const auto next  = (((head >> 32) + 1) << 32) | state->next_free.load(std::memory_order_relaxed);
+      if (free_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+        return state;
     }
   }
-  void detach_all          (std::vector<request>& requests, const detach_all_function& callback)
+  void        release      (state* state)
   {
-    if (const auto stati = test_all(requests))
-      callback(*stati);
-    else 
+    state->natives     .clear();
+    state->positions   .clear();
+    state->statuses    .clear();
+    state->function     = nullptr;
+    state->all_function = nullptr;
+    state->hint         = {};
+    state->next         = nullptr;
+
+    auto head = free_.load(std::memory_order_relaxed);
+    do
     {
-      std::unique_lock lock(list_mutex_);
-      all_requests_queue_       .push_back (new detach_all_state(requests, callback));
-      list_condition_variable_  .notify_one();
+      state->next_free.store(static_cast<std::uint32_t>(head & index_mask), std::memory_order_relaxed);
+    } while (!free_.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | (state->index + 1), std::memory_order_release, std::memory_order_relaxed));
+  }
+  void        grow         ()
+  {
+    std::unique_lock lock(grow_mutex_);
+    if ((free_.load(std::memory_order_acquire) & index_mask) != 0)
+      return;
+    if (chunk_count_ == chunks_.size())
+      throw std::bad_alloc();
+
+    const auto size   = chunk_base << chunk_count_;
+    const auto first  = chunk_base * ((std::uint32_t(1) << chunk_count_) - 1);
+    const auto chunk  = new state[size];
+    for (std::uint32_t i = 0; i < size; ++i)
+    {
+      chunk[i].index = first + i;
+      chunk[i].next_free.store(first + i + 2, std::memory_order_relaxed);
     }
+    chunks_[chunk_count_++].store(chunk, std::memory_order_release);
+
+    auto head = free_.load(std::memory_order_relaxed);
+    do
+    {
+      chunk[size - 1].next_free.store(static_cast<std::uint32_t>(head & index_mask), std::memory_order_relaxed);
+    } while (!free_.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | (first + 1), std::memory_order_release, std::memory_order_relaxed));
   }
 
-protected:
-  std::atomic<bool>            running_                ;
-  std::optional<std::thread>   progress_thread_        ;
-  std::mutex                   progress_mutex_         ;
-  std::mutex                   list_mutex_             ;
-  std::condition_variable      list_condition_variable_;
-  std::list<detach_state*>     single_requests_queue_  ;
-  std::list<detach_state*>     single_requests_        ;
-  std::list<detach_all_state*> all_requests_queue_     ;
-  std::list<detach_all_state*> all_requests_           ;
+  // Inactive requests complete immediately with an empty status. Persistent requests remain with the caller, others are taken over.
+  static void take         (state* state, request& request, const std::size_t position)
+  {
+    if (request.native_ != MPI_REQUEST_NULL)
+    {
+      state->natives  .push_back(request.native_);
+      state->positions.push_back(position);
+    }
+    if (!request.persistent_)
+    {
+      request.managed_ = false;
+      request.native_  = MPI_REQUEST_NULL;
+    }
+  }
+  void        invoke       (state* state)
+  {
+    if (state->function)
+      state->function    (state->statuses[0]);
+    else
+      state->all_function(state->statuses);
+    release(state);
+    outstanding_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  void        dispatch     (std::function<void()>&& function, const execution_hint& hint)
+  {
+    outstanding_.fetch_add(1, std::memory_order_acq_rel);
+    executor_->submit([this, function = std::move(function)]
+    {
+      function();
+      outstanding_.fetch_sub(1, std::memory_order_acq_rel);
+    }, hint);
+  }
+  void        submit       (state* state)
+  {
+    outstanding_.fetch_add(1, std::memory_order_acq_rel);
+
+    auto head = submitted_.load(std::memory_order_relaxed);
+    do
+    {
+      state->next = head;
+    } while (!submitted_.compare_exchange_weak(head, state, std::memory_order_release, std::memory_order_relaxed));
+
+    submissions_.fetch_add (1, std::memory_order_release);
+    submissions_.notify_one();
+  }
+
+  void        run          ()
+  {
+    std::size_t idle     = 0;
+    double      backoff  = policy_.minimum_backoff;
+    auto        observed = submissions_.load(std::memory_order_acquire);
+    while (running_ || outstanding_.load(std::memory_order_acquire) > 0)
+    {
+      if (outstanding_.load(std::memory_order_acquire) == 0)
+      {
+        if (running_) // Blocks until the next submission.
+          submissions_.wait(observed, std::memory_order_acquire);
+        observed = submissions_.load(std::memory_order_acquire);
+        continue;
+      }
+
+      const auto completed = progress();
+      const auto current   = submissions_.load(std::memory_order_acquire);
+      if (completed > 0 || current != observed)
+      {
+        idle     = 0;
+        backoff  = policy_.minimum_backoff;
+        observed = current;
+      }
+      else if (++idle <= policy_.spin_count)
+        continue;
+      else if (idle <= policy_.spin_count + policy_.yield_count)
+        std::this_thread::yield();
+      else
+      {
+        std::this_thread::sleep_for(std::chrono::duration<double>(backoff));
+        backoff = std::min(2 * backoff, policy_.maximum_backoff);
+      }
+    }
+  }
+
+  progress_policy                     policy_          ;
+  std::atomic<bool>                   running_         = true;
+  std::optional<thread_pool>          executor_        ;
+  std::optional<std::thread>          progress_thread_ ;
+
+  std::atomic_flag                    progressing_     ;
+  std::atomic<std::size_t>            outstanding_     = 0;
+  std::atomic<std::uint32_t>          submissions_     = 0;
+  std::atomic<state*>                 submitted_       = nullptr;
+
+  std::atomic<std::uint64_t>          free_            = 0;
+  std::array<std::atomic<state*>, 24> chunks_          {};
+  std::size_t                         chunk_count_     = 0;
+  std::mutex                          grow_mutex_      ;
+
+  // Accessed only while progressing.
+  std::vector<MPI_Request>            natives_         ;
+  std::vector<entry>                  entries_         ;
+  std::vector<MPI_Status>             statuses_        ;
+  std::vector<std::int32_t>           indices_         ;
+  std::vector<state*>                 completed_       ;
 };
 
 // Arguments are only meaningful on the first call to this function.
@@ -1,17 +1,78 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <future>
+#include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include <mpi/core/communicators/communicator.hpp>
+#include <mpi/core/type/compliant_container_traits.hpp>
+#include <mpi/core/type/compliant_traits.hpp>
+#include <mpi/core/utility/container_adapter.hpp>
+#include <mpi/core/utility/span_traits.hpp>
+#include <mpi/core/exception.hpp>
+#include <mpi/core/generalized_request.hpp>
+#include <mpi/core/mpi.hpp>
+#include <mpi/core/op.hpp>
 #include <mpi/core/request.hpp>
+#include <mpi/core/standard_ops.hpp>
+#include <mpi/core/status.hpp>
+#include <mpi/extensions/detach.hpp>
 
 namespace mpi
 {
+namespace detail
+{
+// The state of a generalized request which completes with the given status once a continuation calls complete(). MPI frees the state along with the request.
+struct future_completion
+{
+  [[nodiscard]]
+  static std::pair<generalized_request, future_completion*> start()
+  {
+    const auto          completion = new future_completion;
+    generalized_request request(
+      [ ] (void* state, MPI_Status* status)
+      {
+        *status = static_cast<future_completion*>(state)->status;
+        return MPI_SUCCESS;
+      },
+      [ ] (void* state)
+      {
+        delete static_cast<future_completion*>(state);
+        return MPI_SUCCESS;
+      },
+      [ ] (void*, std::int32_t)
+      {
+        return MPI_SUCCESS;
+      }, completion);
+    completion->native = request.native();
+    return {std::move(request), completion};
+  }
+
+  // The state may be freed upon completion, hence the native is copied beforehand.
+  void complete(const mpi::status& result)
+  {
+    const auto copy = native;
+    status = result.native();
+    MPI_CHECK_ERROR_CODE(MPI_Grequest_complete, (copy))
+  }
+
+  MPI_Request native = MPI_REQUEST_NULL;
+  MPI_Status  status {};
+};
+}
+
 // The std::future       <type> corresponds to MPI requests        , as both are handles to operations which will complete in the future.
 // The std::async        <type> corresponds to MPI immediate  calls, as both are started implicitly.
 // The std::packaged_task<type> corresponds to MPI persistent calls, as both are started explicitly, possibly more than once.
+//
+// Continuations and combinators do not block: they detach the underlying requests (see detach.hpp) and return futures over generalized requests, which the
+// detach context completes once the continuations (and the futures they return) have. Continuations hence run on the progress thread (or the executor) of the
+// detach context, and require thread_support::multiple if they call MPI.
 class future
 {
 public:
@@ -20,6 +81,12 @@ public:
   {
     if (request_.persistent())
       request_.start();
+  }
+  // A ready future with the given status.
+  explicit future  (const status& status) noexcept
+  : request_(MPI_REQUEST_NULL), state_(status)
+  {
+
   }
   future           (const future&  that) = delete ;
   future           (      future&& temp) = default;
@@ -41,7 +108,8 @@ public:
 
   void   wait    () // Forced non-const.
   {
-    state_ = request_.wait();
+    if (!state_)
+      state_ = request_.wait();
   }
   status get     ()
   {
@@ -49,13 +117,32 @@ public:
     return *state_;
   }
 
+  // Registers the continuation with the detach context and returns immediately. The continuation is invoked with a ready future once this one completes, and
+  // the returned future completes with the status of the future returned by the continuation. Consumes this future.
   [[nodiscard]]
-  future then    (const std::function<future(future)>& function)
+  future then    (const std::function<future(future)>& function, detach_context& context = get_detach_context())
   {
-    return function(std::move(*this));
+    auto [result, completion] = detail::future_completion::start();
+    notify(context, [function, &context, completion = completion] (const status& status)
+    {
+      function(future(status)).notify(context, [completion] (const mpi::status& result)
+      {
+        completion->complete(result);
+      });
+    });
+    return std::move(result);
   }
 
 protected:
+  // Invokes the callback once the future completes, on the calling thread if it already has.
+  void   notify  (detach_context& context, const detach_context::detach_function& callback)
+  {
+    if (state_)
+      callback(*state_);
+    else
+      context.detach(request_, callback);
+  }
+
   request               request_;
   std::optional<status> state_  ;
 };
@@ -65,24 +152,183 @@ inline future make_ready_future()
 {
   return request(MPI_REQUEST_NULL);
 }
+// Returns a future which completes (with an empty status) once all requests have. Takes ownership of the non-persistent requests.
 [[nodiscard]]
-inline future when_all         (std::vector<request>& requests)
+inline future when_all         (std::vector<request>& requests, detach_context& context = get_detach_context())
 {
-  return make_ready_future().then([&] (future future)
+  auto [result, completion] = detail::future_completion::start();
+  context.detach_all(requests, [completion = completion] (const std::vector<status>&)
   {
-    [[maybe_unused]] auto result = future.get();
-    wait_all(requests);
-    return make_ready_future();
+    completion->complete(status());
   });
+  return std::move(result);
 }
+// Returns a future which completes with the status of the first request to complete, or immediately if there are none. Takes ownership of the non-persistent
+// requests, the remaining of which complete in the background.
 [[nodiscard]]
-inline future when_any         (std::vector<request>& requests)
+inline future when_any         (std::vector<request>& requests, detach_context& context = get_detach_context())
 {
-  return make_ready_future().then([&] (future future)
-  {
-    [[maybe_unused]] auto result = future.get();
-    wait_any(requests);
+  if (requests.empty())
     return make_ready_future();
+
+  auto [result, completion] = detail::future_completion::start();
+  const auto completed = std::make_shared<std::atomic_flag>();
+  context.detach_each(requests, [completion = completion, completed] (const status& status)
+  {
+    if (!completed->test_and_set())
+      completion->complete(status);
   });
+  return std::move(result);
 }
+
+// A value future owns the buffers of its operation and hands the result over on get(), hence neither their lifetime nor their size is managed by the caller.
+// The result is allocated on the heap, such that moving the future does not move the buffer the operation refers to. Destroying a future whose operation has
+// started but not completed waits for the operation.
+template <typename type>
+class value_future
+{
+public:
+  // Takes ownership of the value which the request operates on, and of any further buffers the request refers to.
+  value_future           (std::unique_ptr<type>&& value, request&& request, std::shared_ptr<const void> retained = nullptr) noexcept
+  : value_(std::move(value)), request_(std::move(request)), retained_(std::move(retained))
+  {
+
+  }
+  // Defers receiving into the container until a message matches, upon which the container is resized to the message.
+  value_future           (const communicator& communicator, const std::int32_t source, const std::int32_t tag)
+  : value_(std::make_unique<type>()), deferred_(communicator.native()), source_(source), tag_(tag)
+  {
+
+  }
+  value_future           (const value_future&  that) = delete ;
+  value_future           (      value_future&& temp) = default;
+  virtual ~value_future  ()
+  {
+    finish();
+  }
+  value_future& operator=(const value_future&  that) = delete ;
+  // Waits for the operation of this future before taking over the other, as the operation writes into the buffer being replaced.
+  value_future& operator=(      value_future&& temp)
+  {
+    if (this != &temp)
+    {
+      finish();
+      value_    = std::move(temp.value_   );
+      request_  = std::move(temp.request_ );
+      retained_ = std::move(temp.retained_);
+      status_   = std::move(temp.status_  );
+      deferred_ = std::exchange(temp.deferred_, MPI_COMM_NULL);
+      source_   = temp.source_;
+      tag_      = temp.tag_;
+    }
+    return *this;
+  }
+
+  [[nodiscard]]
+  bool                 valid   () const noexcept
+  {
+    return static_cast<bool>(value_);
+  }
+  [[nodiscard]]
+  bool                 is_ready()
+  {
+    if (!status_ && start(false))
+      status_ = request_.test();
+    return status_.has_value();
+  }
+
+  const status&        wait    ()
+  {
+    if (!status_)
+    {
+      start(true);
+      status_ = request_.wait();
+    }
+    return *status_;
+  }
+  // Invalidates the future.
+  type                 get     ()
+  {
+    wait();
+    auto result = std::move(*value_);
+    value_.reset();
+    return result;
+  }
+
+protected:
+  // Waits for an operation which has started but not completed.
+  void                 finish  ()
+  {
+    if (value_ && !status_ && request_.native() != MPI_REQUEST_NULL)
+      status_ = request_.wait();
+  }
+  // Starts a deferred receive once a message matches, blocking until then if requested. Returns whether the operation has started.
+  bool                 start   (const bool blocking)
+  {
+    if (deferred_ == MPI_COMM_NULL)
+      return true;
+
+    using adapter = container_adapter<type>;
+    const mpi::communicator communicator(deferred_);
+    auto probed = blocking ? std::optional(communicator.probe_message(source_, tag_)) : communicator.immediate_probe_message(source_, tag_);
+    if (!probed)
+      return false;
+
+    auto& [message, message_status] = *probed;
+    adapter::resize(*value_, static_cast<std::size_t>(message_status.count_x(adapter::data_type())));
+    request_  = message.immediate_receive(*value_);
+    deferred_ = MPI_COMM_NULL;
+    return true;
+  }
+
+  std::unique_ptr<type>       value_    ;
+  request                     request_  {MPI_REQUEST_NULL};
+  std::shared_ptr<const void> retained_ ;
+  std::optional<status>       status_   ;
+
+  MPI_Comm                    deferred_ = MPI_COMM_NULL;
+  std::int32_t                source_   = MPI_ANY_SOURCE;
+  std::int32_t                tag_      = MPI_ANY_TAG;
+};
+
+// Single objects and resizable contiguous containers. The containers are checked first, as checking compliance of a container fails to compile.
+template <typename type>
+concept async_value = (compliant_contiguous_sequential_container<type> && !is_span_v<type>) || compliant<type>;
+
+// Receives a single object, or a contiguous container resized to the matching message.
+template <async_value type> [[nodiscard]]
+value_future<type>              async_receive   (const communicator& communicator, const std::int32_t source = MPI_ANY_SOURCE, const std::int32_t tag = MPI_ANY_TAG)
+{
+  if constexpr (compliant_contiguous_sequential_container<type>)
+    return value_future<type>(communicator, source, tag);
+  else
+  {
+    auto value   = std::make_unique<type>();
+    auto request = communicator.immediate_receive(*value, source, tag);
+    return value_future<type>(std::move(value), std::move(request));
+  }
+}
+// Reduces the data in place within the future.
+template <async_value type> [[nodiscard]]
+value_future<type>              async_all_reduce(const communicator& communicator, type data, const op& op = ops::sum)
+{
+  auto value   = std::make_unique<type>(std::move(data));
+  auto request = communicator.immediate_all_reduce(*value, op);
+  return value_future<type>(std::move(value), std::move(request));
+}
+// Gathers the data of all processes in rank order into a vector on the root, and yields an empty vector on the other processes.
+template <async_value type> [[nodiscard]]
+value_future<std::vector<typename container_adapter<type>::value_type>> async_gather(const communicator& communicator, type data, const std::int32_t root = 0)
+{
+  using adapter     = container_adapter<type>;
+  using result_type = std::vector<typename adapter::value_type>;
+
+  const auto sent  = std::make_shared<const type>(std::move(data));
+  const auto size  = adapter::size(*sent);
+  auto       value = std::make_unique<result_type>(communicator.rank() == root ? size * static_cast<std::size_t>(communicator.size()) : 0);
+  auto request     = communicator.immediate_gather(
+    adapter::data(*sent), static_cast<count>(size), adapter::data_type(),
+    value->data()       , static_cast<count>(size), adapter::data_type(), root);
+  return value_future<result_type>(std::move(value), std::move(request), sent);
 }
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <mpi/core/structs/execution_hint.hpp>
+
+// A work-stealing thread pool. Each worker runs the tasks of its own queue in order, and steals the most recently queued tasks of the others once its own is
+// empty, such that a long task delays neither the tasks queued on other workers nor, once stolen, those queued behind it.
+//
+// Tasks must not throw. The destructor runs the queued tasks before joining the workers.
+namespace mpi
+{
+class thread_pool
+{
+public:
+  using task_type = std::function<void()>;
+
+  explicit thread_pool  (const std::size_t thread_count = std::max(std::thread::hardware_concurrency(), 1u))
+  {
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+      workers_.push_back(std::make_unique<worker>());
+    threads_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+      threads_.emplace_back([this, i] { run(i); });
+  }
+  thread_pool           (const thread_pool&  that) = delete;
+  thread_pool           (      thread_pool&& temp) = delete;
+  virtual ~thread_pool  ()
+  {
+    {
+      std::unique_lock lock(sleep_mutex_);
+      stopping_ = true;
+    }
+    sleep_condition_variable_.notify_all();
+    for (auto& thread : threads_)
+      thread.join();
+  }
+  thread_pool& operator=(const thread_pool&  that) = delete;
+  thread_pool& operator=(      thread_pool&& temp) = delete;
+
+  void        submit      (task_type task, const execution_hint& hint = {})
+  {
+    const auto index = hint.affinity ? *hint.affinity % workers_.size() : next_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    {
+      std::unique_lock lock(workers_[index]->mutex);
+      if (hint.high_priority)
+        workers_[index]->tasks.push_front(std::move(task));
+      else
+        workers_[index]->tasks.push_back (std::move(task));
+    }
+    {
+      std::unique_lock lock(sleep_mutex_); // Prevents the notification from being lost between the predicate check and the wait of a worker.
+      ++queued_;
+    }
+    sleep_condition_variable_.notify_one();
+  }
+
+  [[nodiscard]]
+  std::size_t thread_count() const
+  {
+    return threads_.size();
+  }
+
+protected:
+  struct worker
+  {
+    std::mutex            mutex;
+    std::deque<task_type> tasks;
+  };
+
+  bool        pop         (const std::size_t index, task_type& task)
+  {
+    {
+      auto&            own = *workers_[index];
+      std::unique_lock lock(own.mutex);
+      if (!own.tasks.empty())
+      {
+        task = std::move(own.tasks.front());
+        own.tasks.pop_front();
+        return true;
+      }
+    }
+    for (std::size_t i = 1; i < workers_.size(); ++i)
+    {
+      auto&            other = *workers_[(index + i) % workers_.size()];
+      std::unique_lock lock(other.mutex);
+      if (!other.tasks.empty())
+      {
+        task = std::move(other.tasks.back());
+        other.tasks.pop_back();
+        return true;
+      }
+    }
+    return false;
+  }
+  void        run         (const std::size_t index)
+  {
+    task_type task;
+    while (true)
+    {
+      if (pop(index, task))
+      {
+        {
+          std::unique_lock lock(sleep_mutex_);
+          --queued_;
+        }
+        task();
+        task = nullptr;
+        continue;
+      }
+
+      std::unique_lock lock(sleep_mutex_);
+      sleep_condition_variable_.wait(lock, [&] { return queued_ > 0 || stopping_; });
+      if (stopping_ && queued_ == 0)
+        return;
+    }
+  }
+
+  std::vector<std::unique_ptr<worker>> workers_                 ;
+  std::vector<std::thread>             threads_                 ;
+  std::atomic<std::size_t>             next_                    = 0;
+
+  std::mutex                           sleep_mutex_             ;
+  std::condition_variable              sleep_condition_variable_;
+  std::size_t                          queued_                  = 0;
+  bool                                 stopping_                = false;
+};
+}
\ No newline at end of file
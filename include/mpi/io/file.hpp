@@ -6,6 +6,7 @@
 #include <mpi/core/communicators/communicator.hpp>
 #include <mpi/core/error/error_handler.hpp>
 #include <mpi/core/type/data_type.hpp>
+#include <mpi/core/type/large_count.hpp>
 #include <mpi/core/utility/container_adapter.hpp>
 #include <mpi/core/exception.hpp>
 #include <mpi/core/information.hpp>
@@ -189,17 +190,22 @@ public:
   }
 
   // Read operations.
-  status                               read                  (void* data, const std::int32_t count, const data_type& data_type) const
+  status                               read                  (void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_read, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>               
   status                               read                  (type& data) const
   {
     using adapter = container_adapter<type>;
-    return read(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return read(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   template <typename type>
   std::pair<type, status>              read_n                (const std::int32_t count = 1) const // Named differently to avoid conflict with the type& override where type is std::int32_t.
@@ -210,17 +216,22 @@ public:
     return result;
   }
   
-  status                               read_all              (void* data, const std::int32_t count, const data_type& data_type) const
+  status                               read_all              (void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_read_all, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_all_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_all  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>             
   status                               read_all              (type& data) const
   {
     using adapter = container_adapter<type>;
-    return read_all(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return read_all(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   template <typename type>
   std::pair<type, status>              read_all_n            (const std::int32_t count = 1) const
@@ -231,15 +242,20 @@ public:
     return result;
   }
 
-  void                                 read_all_begin        (void* data, const std::int32_t count, const data_type& data_type) const
+  void                                 read_all_begin        (void* data, const count        size , const data_type& data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_File_read_all_begin, (native_, data, count, data_type.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_all_begin_c, (native_, data, size, data_type.native()))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_all_begin  , (native_, data, large.size(), large.data_type()))
+#endif
   }
   template <typename type>                    
   void                                 read_all_begin        (type& data) const
   {
     using adapter = container_adapter<type>;
-    read_all_begin(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    read_all_begin(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   
   status                               read_all_end          (void* data) const
@@ -255,17 +271,22 @@ public:
     return read_all_end(adapter::data(data));
   }
 
-  status                               read_at               (const offset offset, void* data, const std::int32_t count, const data_type& data_type) const
+  status                               read_at               (const offset offset, void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_read_at, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_at_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_at  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>                  
   status                               read_at               (const offset offset, type& data) const
   {
     using adapter = container_adapter<type>;
-    return read_at(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return read_at(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   template <typename type>
   std::pair<type, status>              read_at_n             (const offset offset, const std::int32_t count = 1) const
@@ -276,17 +297,22 @@ public:
     return result;
   }
   
-  status                               read_at_all           (const offset offset, void* data, const std::int32_t count, const data_type& data_type) const
+  status                               read_at_all           (const offset offset, void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_read_at_all, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_at_all_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_at_all  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>                 
   status                               read_at_all           (const offset offset, type& data) const
   {
     using adapter = container_adapter<type>;
-    return read_at_all(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return read_at_all(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   template <typename type>
   std::pair<type, status>              read_at_all_n         (const offset offset, const std::int32_t count = 1) const
@@ -297,15 +323,20 @@ public:
     return result;
   }
 
-  void                                 read_at_all_begin     (const offset offset, void* data, const std::int32_t count, const data_type& data_type) const
+  void                                 read_at_all_begin     (const offset offset, void* data, const count        size , const data_type& data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_File_read_at_all_begin, (native_, offset, data, count, data_type.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_at_all_begin_c, (native_, offset, data, size, data_type.native()))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_at_all_begin  , (native_, offset, data, large.size(), large.data_type()))
+#endif
   }
   template <typename type>                    
   void                                 read_at_all_begin     (const offset offset, type& data) const
   {
     using adapter = container_adapter<type>;
-    read_at_all_begin(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    read_at_all_begin(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   
   status                               read_at_all_end       (void* data) const
@@ -321,17 +352,22 @@ public:
     return read_at_all_end(adapter::data(data));
   }
   
-  status                               read_ordered          (void* data, const std::int32_t count, const data_type& data_type) const
+  status                               read_ordered          (void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_read_ordered, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_ordered_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_ordered  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>            
   status                               read_ordered          (type& data) const
   {
     using adapter = container_adapter<type>;
-    return read_ordered(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return read_ordered(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   template <typename type>
   std::pair<type, status>              read_ordered_n        (const std::int32_t count = 1) const
@@ -342,15 +378,20 @@ public:
     return result;
   }
 
-  void                                 read_ordered_begin    (void* data, const std::int32_t count, const data_type& data_type) const
+  void                                 read_ordered_begin    (void* data, const count        size , const data_type& data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_File_read_ordered_begin, (native_, data, count, data_type.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_ordered_begin_c, (native_, data, size, data_type.native()))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_ordered_begin  , (native_, data, large.size(), large.data_type()))
+#endif
   }
   template <typename type>                    
   void                                 read_ordered_begin    (type& data) const
   {
     using adapter = container_adapter<type>;
-    read_ordered_begin(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    read_ordered_begin(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   
   status                               read_ordered_end      (void* data) const
@@ -366,17 +407,22 @@ public:
     return read_ordered_end(adapter::data(data));
   }
   
-  status                               read_shared           (void* data, const std::int32_t count, const data_type& data_type) const
+  status                               read_shared           (void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_read_shared, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_read_shared_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_read_shared  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>                  
   status                               read_shared           (type& data) const
   {
     using adapter = container_adapter<type>;
-    return read_shared(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return read_shared(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   template <typename type>
   std::pair<type, status>              read_shared_n         (const std::int32_t count = 1) const // Named differently to avoid conflict with the type& override where type is std::int32_t.
@@ -389,107 +435,147 @@ public:
   
   // Immediate read operations.
   [[nodiscard]]
-  request                              immediate_read        (void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_read        (void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iread, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iread  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_read        (type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_read(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_read(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]
-  request                              immediate_read_all    (void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_read_all    (void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iread_all, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_all_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_all  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_read_all    (type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_read_all(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_read_all(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]
-  request                              immediate_read_at     (const offset offset, void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_read_at     (const offset offset, void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iread_at, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_at_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_at  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_read_at     (const offset offset, type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_read_at(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_read_at(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]
-  request                              immediate_read_at_all (const offset offset, void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_read_at_all (const offset offset, void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iread_at_all, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_at_all_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_at_all  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_read_at_all (const offset offset, type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_read_at_all(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_read_at_all(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]
-  request                              immediate_read_shared (void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_read_shared (void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iread_shared, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_shared_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iread_shared  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_read_shared (type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_read_shared(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_read_shared(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
 
   // Write operations.
-  status                               write                 (const void* data, const std::int32_t count, const data_type& data_type) const
+  status                               write                 (const void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_write    , (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_c  , (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write    , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>              
   status                               write                 (const type& data) const
   {
     using adapter = container_adapter<type>;
-    return write    (adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return write    (adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }                                           
   
-  status                               write_all             (const void* data, const std::int32_t count, const data_type& data_type) const
+  status                               write_all             (const void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_write_all, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_all_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_all  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>             
   status                               write_all             (const type& data) const
   {
     using adapter = container_adapter<type>;
-    return write_all(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return write_all(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
                                                              
-  void                                 write_all_begin       (const void* data, const std::int32_t count, const data_type& data_type) const
+  void                                 write_all_begin       (const void* data, const count        size , const data_type& data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_File_write_all_begin, (native_, data, count, data_type.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_all_begin_c, (native_, data, size, data_type.native()))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_all_begin  , (native_, data, large.size(), large.data_type()))
+#endif
   }
   template <typename type>                                   
   void                                 write_all_begin       (const type& data) const
   {
     using adapter = container_adapter<type>;
-    write_all_begin(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    write_all_begin(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }                                       
   
   status                               write_all_end         (const void* data) const
@@ -505,41 +591,56 @@ public:
     return write_all_end(adapter::data(data));
   }                                          
   
-  status                               write_at              (const offset offset, const void* data, const std::int32_t count, const data_type& data_type) const
+  status                               write_at              (const offset offset, const void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_write_at, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_at_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_at  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>
   status                               write_at              (const offset offset, const type& data) const
   {
     using adapter = container_adapter<type>;
-    return write_at(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return write_at(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   
-  status                               write_at_all          (const offset offset, const void* data, const std::int32_t count, const data_type& data_type) const
+  status                               write_at_all          (const offset offset, const void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_write_at_all, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_at_all_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_at_all  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>
   status                               write_at_all          (const offset offset, const type& data) const
   {
     using adapter = container_adapter<type>;
-    return write_at_all(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return write_at_all(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
                                                              
-  void                                 write_at_all_begin    (const offset offset, const void* data, const std::int32_t count, const data_type& data_type) const
+  void                                 write_at_all_begin    (const offset offset, const void* data, const count        size , const data_type& data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_File_write_at_all_begin, (native_, offset, data, count, data_type.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_at_all_begin_c, (native_, offset, data, size, data_type.native()))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_at_all_begin  , (native_, offset, data, large.size(), large.data_type()))
+#endif
   }
   template <typename type>                                   
   void                                 write_at_all_begin    (const offset offset, const type& data) const
   {
     using adapter = container_adapter<type>;
-    write_at_all_begin(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    write_at_all_begin(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }                                             
   
   status                               write_at_all_end      (const void* data) const
@@ -555,28 +656,38 @@ public:
     return write_at_all_end(adapter::data(data));
   }                                    
   
-  status                               write_ordered         (const void* data, const std::int32_t count, const data_type& data_type) const
+  status                               write_ordered         (const void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_write_ordered, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_ordered_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_ordered  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>               
   status                               write_ordered         (const type& data) const
   {
     using adapter = container_adapter<type>;
-    return write_ordered(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return write_ordered(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
                                                              
-  void                                 write_ordered_begin   (const void* data, const std::int32_t count, const data_type& data_type) const
+  void                                 write_ordered_begin   (const void* data, const count        size , const data_type& data_type) const
   {
-    MPI_CHECK_ERROR_CODE(MPI_File_write_ordered_begin, (native_, data, count, data_type.native()))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_ordered_begin_c, (native_, data, size, data_type.native()))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_ordered_begin  , (native_, data, large.size(), large.data_type()))
+#endif
   }
   template <typename type>                                   
   void                                 write_ordered_begin   (const type& data) const
   {
     using adapter = container_adapter<type>;
-    write_ordered_begin(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    write_ordered_begin(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }                                            
   
   status                               write_ordered_end     (const void* data) const
@@ -592,84 +703,114 @@ public:
     return write_ordered_end(adapter::data(data));
   }
 
-  status                               write_shared          (const void* data, const std::int32_t count, const data_type& data_type) const
+  status                               write_shared          (const void* data, const count        size , const data_type& data_type) const
   {
     status result;
-    MPI_CHECK_ERROR_CODE(MPI_File_write_shared, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_write_shared_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_write_shared  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type>
   status                               write_shared          (const type& data) const
   {
     using adapter = container_adapter<type>;
-    return write_shared(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return write_shared(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
 
   // Immediate write operations.
   [[nodiscard]]
-  request                              immediate_write       (const void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_write       (const void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iwrite, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_write       (const type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_write(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_write(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]                                              
-  request                              immediate_write_all   (const void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_write_all   (const void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_all, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_all_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_all  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_write_all   (const type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_write_all(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_write_all(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]                                              
-  request                              immediate_write_at    (const offset offset, const void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_write_at    (const offset offset, const void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_at, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_at_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_at  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]                     
   request                              immediate_write_at    (const offset offset, const type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_write_at(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_write_at(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]
-  request                              immediate_write_at_all(const offset offset, const void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_write_at_all(const offset offset, const void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_at_all, (native_, offset, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_at_all_c, (native_, offset, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_at_all  , (native_, offset, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]
   request                              immediate_write_at_all(const offset offset, const type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_write_at_all(offset, adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_write_at_all(offset, adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
   [[nodiscard]]
-  request                              immediate_write_shared(const void* data, const std::int32_t count, const data_type& data_type) const
+  request                              immediate_write_shared(const void* data, const count        size , const data_type& data_type) const
   {
     request result(MPI_REQUEST_NULL, true);
-    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_shared, (native_, data, count, data_type.native(), &result.native_))
+#ifdef MPI_GEQ_4_0
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_shared_c, (native_, data, size, data_type.native(), &result.native_))
+#else
+    const large_count large(size, data_type);
+    MPI_CHECK_ERROR_CODE(MPI_File_iwrite_shared  , (native_, data, large.size(), large.data_type(), &result.native_))
+#endif
     return result;
   }
   template <typename type> [[nodiscard]]
   request                              immediate_write_shared(const type& data) const
   {
     using adapter = container_adapter<type>;
-    return immediate_write_shared(adapter::data(data), static_cast<std::int32_t>(adapter::size(data)), adapter::data_type());
+    return immediate_write_shared(adapter::data(data), static_cast<count>(adapter::size(data)), adapter::data_type());
   }
 
   [[nodiscard]]
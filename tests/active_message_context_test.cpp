@@ -0,0 +1,72 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+struct visit
+{
+  std::int32_t vertex  ;
+  std::int32_t distance;
+};
+
+TEST_CASE("Active Message Context Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  enum handlers : mpi::active_message_context::handler_id
+  {
+    accumulate,
+    request   ,
+    respond   ,
+    relay
+  };
+
+  mpi::active_message_context context(communicator);
+
+  std::int64_t sum       = 0;
+  std::int32_t responses = 0;
+  std::int32_t relayed   = 0;
+  context.register_handler<std::int64_t>(accumulate, [&] (const std::int64_t& value  , const std::int32_t)
+  {
+    sum += value;
+  });
+  context.register_handler<std::int32_t>(request   , [&] (const std::int32_t& value  , const std::int32_t source)
+  {
+    context.send(respond, 2 * value, source);
+  });
+  context.register_handler<std::int32_t>(respond   , [&] (const std::int32_t& value  , const std::int32_t)
+  {
+    REQUIRE(value == 2 * rank);
+    ++responses;
+  });
+  context.register_handler<visit>       (relay     , [&] (const visit&        payload, const std::int32_t source)
+  {
+    REQUIRE(payload.vertex == source);
+    if (payload.distance > 0)
+      context.send(relay, visit {rank, payload.distance - 1}, (rank + 1) % size);
+    else
+      ++relayed;
+  });
+
+  // Single payloads and batches.
+  for (std::int32_t i = 0; i < size; ++i)
+    context.send(accumulate, std::int64_t(rank), i);
+  std::vector<std::int64_t> batch(10, 1);
+  context.send(accumulate, std::span<const std::int64_t>(batch), (rank + 1) % size);
+  context.synchronize();
+  REQUIRE(sum == static_cast<std::int64_t>(size) * (size - 1) / 2 + 10);
+
+  // Requests answered by the handler, and chains of messages across all processes.
+  for (std::int32_t i = 0; i < 5; ++i)
+    context.send(request, rank, (rank + i) % size);
+  context.send(relay, visit {rank, 2 * size}, (rank + 1) % size);
+  while (responses < 5)
+    context.progress();
+  context.synchronize();
+  REQUIRE(responses == 5);
+  REQUIRE(relayed   == 1);
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Address Data Type Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    // Spans several blocks of the deque.
+    std::deque<std::int32_t> data(10000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+      data[i] = static_cast<std::int32_t>(i);
+
+    const auto first  = mpi::deque_data_type(data);
+    const auto second = mpi::deque_data_type(data);
+    REQUIRE(first.native() == second.native());
+    REQUIRE(first.size  () == static_cast<std::int32_t>(data.size() * sizeof(std::int32_t)));
+  }
+
+  if (size > 1 && rank < 2)
+  {
+    if (rank == 0)
+    {
+      std::deque<std::int32_t> data;
+      for (std::int32_t i = 0; i < 10000; ++i)
+        data.push_front(i);
+
+      communicator.send(data, 1);
+      auto request = communicator.immediate_send(data, 1);
+      request.wait();
+
+      communicator.send(std::vector<std::string> {"first", "", "third record"}, 1);
+    }
+    else
+    {
+      std::deque<std::int32_t> data;
+      communicator.receive(data, 0, 0, true);
+      REQUIRE(data.size () == 10000);
+      REQUIRE(data.front() == 9999 );
+      REQUIRE(data.back () == 0    );
+
+      std::deque<std::int32_t> other(10000);
+      communicator.receive(other, 0, 0);
+      REQUIRE(other == data);
+
+      std::vector<std::string> strings {"stale"};
+      communicator.receive(strings, 0, 0);
+      REQUIRE(strings.size() == 3);
+      REQUIRE(strings[0]     == "first");
+      REQUIRE(strings[1]     == "");
+      REQUIRE(strings[2]     == "third record");
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+struct particle_stats
+{
+  double               energy  ;
+  std::int32_t         count   ;
+  std::array<float, 3> momentum;
+};
+
+TEST_CASE("Aggregate Op Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    std::vector<particle_stats> data(4);
+    for (std::size_t i = 0; i < data.size(); ++i)
+      data[i] = {static_cast<double>(i), rank, {1.0f, static_cast<float>(rank), static_cast<float>(i)}};
+
+    communicator.all_reduce(data, mpi::ops::sum);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+      REQUIRE(data[i].count       == size * (size - 1) / 2);
+      REQUIRE(data[i].energy      == static_cast<double>(size * i));
+      REQUIRE(data[i].momentum[0] == static_cast<float >(size));
+      REQUIRE(data[i].momentum[1] == static_cast<float >(size * (size - 1) / 2));
+      REQUIRE(data[i].momentum[2] == static_cast<float >(size * i));
+    }
+  }
+
+  {
+    std::pair<std::int32_t, float> data {rank, -static_cast<float>(rank)};
+    communicator.all_reduce(data, mpi::ops::maximum);
+    REQUIRE(data.first  == size - 1);
+    REQUIRE(data.second == 0.0f);
+  }
+
+  {
+    std::array<std::int32_t, 2> sent {rank, rank + 1};
+    std::array<std::int32_t, 2> received {};
+    communicator.reduce(sent, received, mpi::ops::minimum);
+    if (rank == 0)
+    {
+      REQUIRE(received[0] == 0);
+      REQUIRE(received[1] == 1);
+    }
+  }
+}
\ No newline at end of file
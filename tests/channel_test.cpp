@@ -0,0 +1,83 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Channel Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    mpi::tag_allocator allocator(99);
+    const auto first  = allocator.allocate(10);
+    const auto second = allocator.allocate(20);
+    REQUIRE(first ->first == 90);
+    REQUIRE(second->first == 70);
+    REQUIRE(allocator.free_count() == 70);
+    REQUIRE(!allocator.allocate(71));
+
+    allocator.release(*first);
+    REQUIRE(allocator.allocate(10)->first == 90);
+    allocator.release({90, 10});
+    allocator.release(*second);
+    REQUIRE(allocator.free_count() == 100);
+    REQUIRE(allocator.allocate(100)->first == 0);
+  }
+
+  {
+    // The ranges are shared by all objects of the native communicator, and respect the upper bound.
+    const auto first  = communicator.allocate_tags(4);
+    const auto second = mpi::communicator(communicator.native()).allocate_tags(4);
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(first ->first + first->count - 1 == mpi::tag_upper_bound());
+    REQUIRE(second->first + 4 == first->first);
+    communicator.release_tags(*second);
+    communicator.release_tags(*first );
+  }
+
+  {
+    // Two channels on the same communicator using the same relative tags do not match each other's messages.
+    const mpi::channel   first (communicator, 2);
+    const mpi::channel   second(communicator);
+    REQUIRE(first.range().first != second.range().first);
+
+    const auto           next     = (rank + 1)        % size;
+    const auto           previous = (rank + size - 1) % size;
+    auto                 request0 = second.immediate_send(std::int32_t(2 * rank), next);
+    auto                 request1 = first .immediate_send(std::int32_t(    rank), next);
+    auto                 request2 = first .immediate_send(std::int32_t(3 * rank), next, 1);
+
+    std::int32_t         value    = -1;
+    const auto           status   = first.receive(value, previous);
+    REQUIRE(value           == previous);
+    REQUIRE(status.tag   () == 0);
+    REQUIRE(status.source() == previous);
+
+    std::vector<std::int32_t> values;
+    first.receive(values, previous, 1, true);
+    REQUIRE(values == std::vector<std::int32_t> {3 * previous});
+
+    const auto probed = second.probe(previous);
+    REQUIRE(probed.tag() == 0);
+    second.receive(value, previous);
+    REQUIRE(value == 2 * previous);
+
+    request0.wait();
+    request1.wait();
+    request2.wait();
+
+    // Relative tags outside the range are rejected.
+    REQUIRE_THROWS_AS(static_cast<void>(first.native_tag(2 )), mpi::exception);
+    REQUIRE_THROWS_AS(static_cast<void>(first.native_tag(-1)), mpi::exception);
+  }
+
+  // The ranges of destroyed channels are released.
+  const auto range = communicator.allocate_tags(3);
+  REQUIRE(range->first + range->count - 1 == mpi::tag_upper_bound());
+  communicator.release_tags(*range);
+}
\ No newline at end of file
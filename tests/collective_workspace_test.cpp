@@ -0,0 +1,79 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Collective Workspace Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  mpi::collective_workspace workspace;
+
+  // Repeated exchanges reuse the arrays of the workspace.
+  std::array<std::int32_t*, 3> arrays {};
+  for (auto iteration = 0; iteration < 3; ++iteration)
+  {
+    {
+      const std::vector<std::int32_t> sent(rank + 1, rank);
+      std::vector<std::int32_t>       received;
+      communicator.all_gather_varying(sent, received, workspace, true);
+      REQUIRE(received.size() == static_cast<std::size_t>(size * (size + 1) / 2));
+      REQUIRE(received.back() == size - 1);
+    }
+
+    {
+      const std::vector<std::int32_t> sent(rank + 1, rank);
+      std::vector<std::int32_t>       received;
+      communicator.gather_varying(sent, received, workspace, 0, true);
+      if (rank == 0)
+      {
+        REQUIRE(received.size() == static_cast<std::size_t>(size * (size + 1) / 2));
+        REQUIRE(received.back() == size - 1);
+      }
+    }
+
+    {
+      // Process i sends j + 1 elements to process j.
+      const std::vector<std::int32_t> sent_sizes = [&]
+      {
+        std::vector<std::int32_t> result(size);
+        std::iota(result.begin(), result.end(), 1);
+        return result;
+      } ();
+      const std::vector<std::int32_t> sent(std::reduce(sent_sizes.begin(), sent_sizes.end()), rank);
+      std::vector<std::int32_t>       received;
+      communicator.all_to_all_varying(sent, sent_sizes, received, workspace, true);
+      REQUIRE(received.size() == static_cast<std::size_t>(size * (rank + 1)));
+      REQUIRE(received.back() == size - 1);
+    }
+
+    {
+      std::vector<std::int32_t> sent_sizes(size);
+      std::iota(sent_sizes.begin(), sent_sizes.end(), 1);
+      const std::vector<std::int32_t> sent(rank == 0 ? std::reduce(sent_sizes.begin(), sent_sizes.end()) : 0, 42);
+      std::vector<std::int32_t>       received;
+      communicator.scatter_varying(sent, received, sent_sizes, workspace, 0, true);
+      REQUIRE(received.size() == static_cast<std::size_t>(rank + 1));
+      REQUIRE(received.back() == 42);
+    }
+
+    const std::array current {workspace.sent_displacements().data(), workspace.received_sizes().data(), workspace.received_displacements().data()};
+    if (iteration > 0)
+      REQUIRE(current == arrays);
+    arrays = current;
+  }
+
+  // Braced lists select the std::vector overloads.
+  if (size == 1)
+  {
+    std::vector<std::int32_t> data {rank, rank};
+    communicator.all_gather_varying(data, {2}, {0});
+    REQUIRE(data.back() == rank);
+  }
+
+  REQUIRE(workspace.received_sizes().size() == static_cast<std::size_t>(size));
+}
\ No newline at end of file
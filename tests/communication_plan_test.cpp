@@ -0,0 +1,52 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Communication Plan Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  // A ring exchange followed by a global sum, as in the halo exchange of an iterative solver.
+  const auto                next     = (rank + 1       ) % size;
+  const auto                previous = (rank - 1 + size) % size;
+  std::vector<std::int32_t> halo     (4, 0);
+  std::vector<std::int32_t> boundary (4, 0);
+  std::int32_t              local    (0);
+  std::int32_t              global   (0);
+  std::vector<std::int32_t> gathered (size, 0);
+  std::int32_t              root_value(0);
+
+  mpi::communication_plan plan(communicator);
+  plan
+    .receive   (halo    , previous, 0)
+    .send      (boundary, next    , 0)
+    .all_reduce(local   , global)
+    .all_gather(local   , gathered)
+    .broadcast (root_value)
+    .barrier   ();
+  REQUIRE(plan.size() == 6);
+
+  for (std::int32_t iteration = 0; iteration < 5; ++iteration)
+  {
+    std::fill(boundary.begin(), boundary.end(), rank + iteration);
+    local      = rank + iteration;
+    root_value = rank == 0 ? iteration : -1;
+
+    plan.execute();
+
+    REQUIRE(halo.front() == previous + iteration);
+    REQUIRE(halo.back () == previous + iteration);
+    REQUIRE(global       == size * (size - 1) / 2 + size * iteration);
+    REQUIRE(gathered.back() == size - 1 + iteration);
+    REQUIRE(root_value   == iteration);
+  }
+
+  plan.start();
+  plan.wait ();
+  REQUIRE(plan.test());
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <cmath>
+#include <random>
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Compression Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  // Small chunks and several threads, such that the chunking is exercised.
+  const mpi::compression_policy policy {1024, 4096, 3};
+
+  std::vector<double> smooth(10000);
+  for (std::size_t i = 0; i < smooth.size(); ++i)
+    smooth[i] = std::sin(static_cast<double>(i) * 1e-3) + rank;
+
+  std::vector<std::int32_t> noise(777);
+  std::mt19937              generator(42);
+  for (auto& value : noise)
+    value = static_cast<std::int32_t>(generator());
+
+  {
+    // The codec reconstructs the data exactly, compresses smooth data and does not expand incompressible data beyond its headers.
+    const auto check = [&] (const auto& data)
+    {
+      const std::span<const std::byte> bytes(reinterpret_cast<const std::byte*>(data.data()), data.size() * sizeof(data[0]));
+      const auto compressed = mpi::compress(bytes, sizeof(data[0]), policy);
+      REQUIRE(mpi::decompressed_size(compressed) == bytes.size());
+
+      std::vector<std::byte> result(bytes.size());
+      REQUIRE(mpi::decompress(compressed, result.data(), result.size(), policy));
+      REQUIRE(std::ranges::equal(bytes, result));
+      return compressed.size();
+    };
+
+    REQUIRE(check(smooth) < smooth.size() * sizeof(double) * 9 / 10);
+    REQUIRE(check(noise ) < noise .size() * sizeof(std::int32_t) + 128);
+    REQUIRE(check(std::vector<std::int64_t>(5000, 7)) < 1000);
+    REQUIRE(check(std::vector<float>()) == sizeof(mpi::compression_header));
+
+    auto corrupted = mpi::compress(std::as_bytes(std::span(smooth)), sizeof(double), policy);
+    corrupted.resize(corrupted.size() - 1);
+    std::vector<std::byte> result(smooth.size() * sizeof(double));
+    REQUIRE(!mpi::decompress(corrupted, result.data(), result.size(), policy));
+  }
+
+  const auto next     = (rank + 1)        % size;
+  const auto previous = (rank + size - 1) % size;
+
+  {
+    // Blocking, with and without resizing, above and below the threshold.
+    auto request = communicator.immediate_compressed_send(smooth, next, 0, policy);
+    std::vector<double> received(smooth.size());
+    communicator.compressed_receive(received, previous, 0, false, policy);
+    request.wait();
+    for (std::size_t i = 0; i < received.size(); ++i)
+      REQUIRE(received[i] == std::sin(static_cast<double>(i) * 1e-3) + previous);
+
+    std::vector<std::int32_t> small {rank, rank, rank};
+    communicator.compressed_send(small, rank, 1, policy);
+    std::vector<std::int32_t> resized;
+    communicator.compressed_receive(resized, rank, 1, true, policy);
+    REQUIRE(resized == small);
+  }
+
+  {
+    // Immediate receives are posted once the message arrives.
+    std::vector<std::int32_t> received(noise.size());
+    auto receive = communicator.immediate_compressed_receive(received, previous, 2, policy);
+    REQUIRE(!receive.test());
+    communicator.barrier();
+
+    auto send = communicator.immediate_compressed_send(noise, next, 2, policy);
+    while (!receive.test())
+      ;
+    send.wait();
+    REQUIRE(receive.test()->source() == previous);
+    REQUIRE(received == noise);
+  }
+
+  {
+    // Destroying an immediate receive waits for the message, even if it has not been probed yet.
+    const std::vector<std::int32_t> sent     {rank, rank, rank};
+    std::vector<std::int32_t>       received (sent.size());
+    {
+      auto receive = communicator.immediate_compressed_receive(received, rank, 3, policy);
+      auto moved   = std::move(receive);
+      communicator.compressed_send(sent, rank, 3, policy);
+    }
+    REQUIRE(received == sent);
+  }
+}
\ No newline at end of file
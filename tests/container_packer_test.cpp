@@ -0,0 +1,73 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Container Packer Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    std::map<std::int32_t, float> data;
+    if (rank == 0)
+      data = {{1, 1.0f}, {2, 2.0f}, {3, 3.0f}};
+    communicator.broadcast(data);
+    REQUIRE(data.size() == 3);
+    REQUIRE(data.at(2)  == 2.0f);
+  }
+
+  {
+    std::vector<bool> data;
+    if (rank == 0)
+      data = {true, false, true, true};
+    communicator.broadcast(data);
+    REQUIRE(data.size() == 4);
+    REQUIRE(data[2]     == true);
+    REQUIRE(data[1]     == false);
+  }
+
+  {
+    const std::list<std::int32_t> sent    {rank, rank};
+    std::deque<std::int32_t>      received;
+    communicator.gather(sent, received, 0);
+    if (rank == 0)
+    {
+      REQUIRE(received.size() == static_cast<std::size_t>(2 * size));
+      REQUIRE(received.back() == size - 1);
+    }
+
+    std::list<std::int32_t> varying(static_cast<std::size_t>(rank) + 1, rank);
+    communicator.gather(varying, received, 0);
+    if (rank == 0)
+    {
+      REQUIRE(received.size() == static_cast<std::size_t>(size * (size + 1) / 2));
+      REQUIRE(received.back() == size - 1);
+      REQUIRE(std::count(received.begin(), received.end(), size - 1) == size);
+    }
+  }
+
+  if (size > 1 && rank < 2)
+  {
+    if (rank == 0)
+    {
+      communicator.send(std::forward_list<std::int32_t>{1, 2, 3}, 1);
+      communicator.send(std::set<std::int32_t>{4, 5}, 1);
+    }
+    else
+    {
+      std::forward_list<std::int32_t> list;
+      communicator.receive(list, 0, 0, true);
+      REQUIRE(list.front() == 1);
+      REQUIRE(std::distance(list.begin(), list.end()) == 3);
+
+      std::set<std::int32_t> set {0, 0};
+      communicator.receive(set, 0, 0, true);
+      REQUIRE(set.size() == 2);
+      REQUIRE(set.count(5) == 1);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+namespace
+{
+mpi::task<std::int32_t> exchange    (const mpi::communicator& communicator, const std::int32_t value, const std::int32_t tag)
+{
+  const auto   rank     = communicator.rank();
+  const auto   size     = communicator.size();
+  std::int32_t received = -1;
+
+  auto       receive = communicator.immediate_receive(received, (rank + size - 1) % size, tag);
+  co_await communicator.immediate_send(value, (rank + 1) % size, tag);
+  const auto status  = co_await receive;
+  REQUIRE(status.tag   () == tag);
+  REQUIRE(status.source() == (rank + size - 1) % size);
+  co_return received;
+}
+mpi::task<>             ring        (const mpi::communicator& communicator, const std::int32_t tag, std::int32_t& result)
+{
+  // Each round passes the value on to the next process, hence it returns to its origin after size rounds.
+  auto value = communicator.rank() * 1000 + tag;
+  for (std::int32_t i = 0; i < communicator.size(); ++i)
+    value = co_await exchange(communicator, value, tag);
+  result = value;
+}
+mpi::task<>             persistent  (const mpi::communicator& communicator, std::int32_t& result)
+{
+  const auto   rank     = communicator.rank();
+  const auto   size     = communicator.size();
+  std::int32_t sent     = 0;
+  std::int32_t received = 0;
+  auto         send     = communicator.persistent_send   (sent    , (rank + 1       ) % size, 4242);
+  auto         receive  = communicator.persistent_receive(received, (rank + size - 1) % size, 4242);
+  for (std::int32_t i = 0; i < 10; ++i)
+  {
+    sent = i + rank;
+    receive.start();
+    send   .start();
+    co_await send;
+    co_await receive;
+    result += received;
+  }
+}
+mpi::task<>             failing     ()
+{
+  throw std::runtime_error("failing task");
+  co_return;
+}
+}
+
+TEST_CASE("Coroutine Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    constexpr std::int32_t    task_count = 256;
+    std::vector<std::int32_t> results(task_count, -1);
+
+    mpi::request_scheduler scheduler(2 * task_count);
+    for (std::int32_t i = 0; i < task_count; ++i)
+      scheduler.spawn(ring(communicator, i, results[i]));
+    scheduler.run();
+
+    REQUIRE(scheduler.pending() == 0);
+    for (std::int32_t i = 0; i < task_count; ++i)
+      REQUIRE(results[i] == rank * 1000 + i);
+  }
+
+  {
+    std::int32_t result = 0;
+
+    mpi::request_scheduler scheduler;
+    scheduler.spawn(persistent(communicator, result));
+    scheduler.run();
+
+    const auto source = (rank + size - 1) % size;
+    REQUIRE(result == 45 + 10 * source);
+  }
+
+  {
+    mpi::request_scheduler scheduler;
+    scheduler.spawn(failing());
+    REQUIRE_THROWS_AS(scheduler.run(), std::runtime_error);
+  }
+
+  communicator.barrier();
+}
\ No newline at end of file
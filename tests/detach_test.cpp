@@ -0,0 +1,86 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Detach Test")
+{
+  mpi::environment environment  (nullptr, nullptr, mpi::thread_support::multiple);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+  const auto       next         = (rank + 1       ) % size;
+  const auto       previous     = (rank + size - 1) % size;
+
+  {
+    // Without a progress thread, callbacks are invoked by progress() (including those of requests detached within callbacks) and by the destructor.
+    constexpr std::int32_t    count = 1000;
+    std::vector<std::int32_t> sent(count), received(count, -1);
+    std::size_t               completed = 0;
+    std::size_t               nested    = 0;
+    {
+      mpi::detach_context context(false);
+      for (std::int32_t i = 0; i < count; ++i)
+      {
+        sent[i] = rank * count + i;
+        auto request = communicator.immediate_receive(received[i], previous, i);
+        context.detach(request, [&, i] (const mpi::status& status)
+        {
+          REQUIRE(status.tag() == i);
+          ++completed;
+        });
+        REQUIRE(request.native() == MPI_REQUEST_NULL);
+      }
+
+      std::vector<mpi::request> requests;
+      for (std::int32_t i = 0; i < count; ++i)
+        requests.push_back(communicator.immediate_send(sent[i], next, i));
+      context.detach_all(requests, [&] (const std::vector<mpi::status>& statuses)
+      {
+        REQUIRE(statuses.size() == count);
+        std::vector<mpi::request> inner;
+        inner.push_back(communicator.immediate_send   (sent    [0], rank, count));
+        inner.push_back(communicator.immediate_receive(received[0], rank, count));
+        context.detach_each(inner, [&] (const mpi::status&) { ++nested; });
+      });
+
+      while (completed < count)
+        context.progress();
+    }
+    REQUIRE(nested == 2);
+    for (std::int32_t i = 0; i < count; ++i)
+      REQUIRE(received[i] == (i == 0 ? sent[0] : previous * count + i));
+  }
+
+  {
+    // Persistent requests remain with the caller, and may be detached again once restarted.
+    std::int32_t             sent     = rank;
+    std::int32_t             received = -1;
+    std::atomic<std::size_t> completed(0);
+    auto                     send     = communicator.persistent_send   (sent    , next    , 1);
+    auto                     receive  = communicator.persistent_receive(received, previous, 1);
+
+    mpi::detach_context context;
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+      receive.start();
+      send   .start();
+      context.detach(receive, [&] (const mpi::status&) { completed.fetch_add(1); });
+      REQUIRE(receive.native() != MPI_REQUEST_NULL);
+      send.wait();
+      while (completed != i + 1)
+        std::this_thread::yield();
+      REQUIRE(received == previous);
+    }
+    REQUIRE(context.outstanding() == 0);
+  }
+
+  communicator.barrier();
+}
\ No newline at end of file
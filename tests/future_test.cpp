@@ -6,7 +6,7 @@
 
 TEST_CASE("Future Test")
 {
-  mpi::environment environment  ;
+  mpi::environment environment  (nullptr, nullptr, mpi::thread_support::multiple);
   const auto&      communicator = mpi::world_communicator;
 
   std::int32_t data = 0;
@@ -83,4 +83,45 @@ TEST_CASE("Future Test")
 
   REQUIRE(data_1 == 2);
   REQUIRE(data_2 == 2);
+
+  // Continuations are registered without blocking, and run once the receive completes.
+  const auto   rank     = communicator.rank();
+  const auto   size     = communicator.size();
+  std::int32_t received = -1;
+  std::int32_t sent     = rank;
+  // The continuation runs on the progress thread, hence records its observations for the assertions on this thread.
+  std::atomic<bool>         continued(false);
+  std::atomic<bool>         ready    (false);
+  std::atomic<std::int32_t> tag      (-1);
+  auto chained = mpi::future(communicator.immediate_receive(received, (rank + size - 1) % size, 7)).then([&] (mpi::future future)
+  {
+    ready     = future.is_ready();
+    tag       = future.get().tag();
+    continued = true;
+    return mpi::make_ready_future();
+  });
+  REQUIRE(!continued); // No process sends before all have passed the barrier.
+  communicator.barrier();
+  communicator.send(sent, (rank + 1) % size, 7);
+  chained.get();
+  REQUIRE(continued);
+  REQUIRE(ready);
+  REQUIRE(tag == 7);
+  REQUIRE(received == (rank + size - 1) % size);
+
+  std::int32_t first  = -1;
+  std::int32_t second = -1;
+  requests.clear();
+  requests.push_back(communicator.immediate_receive(first , (rank + size - 1) % size, 8));
+  requests.push_back(communicator.immediate_receive(second, (rank + size - 1) % size, 9));
+  auto any = mpi::when_any(requests);
+  communicator.send(sent, (rank + 1) % size, 9);
+  REQUIRE(any.get().tag() == 9);
+  REQUIRE(second == (rank + size - 1) % size);
+  communicator.barrier(); // The other request completes in the background.
+  communicator.send(sent, (rank + 1) % size, 8);
+  while (mpi::get_detach_context().outstanding() > 0) // It receives into this frame, hence must complete before the test returns.
+    std::this_thread::yield();
+  REQUIRE(first == (rank + size - 1) % size);
+  communicator.barrier();
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Hierarchical Communicator Test")
+{
+  mpi::environment environment  ;
+  const auto&      world        = mpi::world_communicator;
+  const auto       rank         = world.rank();
+  const auto       size         = world.size();
+
+  // Nodes of shared memory, as well as emulated nodes of two processes (in reverse order) which exercise the inter-node phase on a single machine.
+  std::vector<std::unique_ptr<mpi::hierarchical_communicator>> communicators;
+  communicators.push_back(std::make_unique<mpi::hierarchical_communicator>(world));
+  communicators.push_back(std::make_unique<mpi::hierarchical_communicator>(world, (size - 1 - rank) / 2));
+
+  for (const auto& communicator : communicators)
+  {
+    const auto& descriptor = communicator->descriptor();
+    REQUIRE(descriptor.node_size() == descriptor.node().size());
+    REQUIRE(descriptor.is_leader() == (descriptor.node().rank() == 0));
+
+    communicator->hierarchical_barrier();
+
+    {
+      std::vector<std::int32_t> data(3, rank == size - 1 ? 42 : 0);
+      communicator->hierarchical_broadcast(data, size - 1);
+      REQUIRE(data == std::vector<std::int32_t>(3, 42));
+    }
+
+    {
+      std::vector<double> sent {1.0, static_cast<double>(rank), static_cast<double>(rank * rank)}, received(3);
+      communicator->hierarchical_all_reduce(sent, received);
+      REQUIRE(received[0] == static_cast<double>(size));
+      REQUIRE(received[1] == static_cast<double>(size * (size - 1) / 2));
+      REQUIRE(received[2] == static_cast<double>((size - 1) * size * (2 * size - 1) / 6));
+
+      std::int32_t maximum = rank;
+      communicator->hierarchical_all_reduce(maximum, mpi::ops::maximum);
+      REQUIRE(maximum == size - 1);
+    }
+
+    {
+      std::vector<std::int32_t> sent {rank, -rank}, received;
+      communicator->hierarchical_all_gather(sent, received, true);
+      REQUIRE(received.size() == static_cast<std::size_t>(2 * size));
+      for (std::int32_t i = 0; i < size; ++i)
+      {
+        REQUIRE(received[2 * i    ] ==  i);
+        REQUIRE(received[2 * i + 1] == -i);
+      }
+    }
+
+    {
+      // Growing the shared memory window.
+      std::vector<std::int64_t> data(100000, rank);
+      communicator->hierarchical_all_reduce(data);
+      REQUIRE(data.front() == size * (size - 1) / 2);
+      REQUIRE(data.back () == size * (size - 1) / 2);
+    }
+  }
+}
\ No newline at end of file
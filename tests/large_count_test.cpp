@@ -0,0 +1,124 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+#define MPI_LARGE_COUNT_THRESHOLD 1000
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Large Count Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    std::vector<std::int32_t> data(8, rank);
+    communicator.all_reduce(data);
+    REQUIRE(data[7] == size * (size - 1) / 2);
+  }
+
+  {
+    std::vector<mpi::count>   sizes   (size, 2);
+    std::vector<std::int32_t> sent    (2 * size, rank);
+    std::vector<std::int32_t> received;
+    communicator.all_to_all_varying(sent, sizes, received, sizes, true);
+    for (std::int32_t i = 0; i < size; ++i)
+      REQUIRE(received[2 * i] == i);
+  }
+
+  {
+    std::vector<mpi::count>   sizes   (size, 1);
+    std::vector<std::int32_t> received;
+    communicator.all_gather_varying(std::vector<std::int32_t>{rank}, received, sizes, true);
+    for (std::int32_t i = 0; i < size; ++i)
+      REQUIRE(received[i] == i);
+
+    std::vector<mpi::aint>    displacements(size);
+    std::exclusive_scan(sizes.begin(), sizes.end(), displacements.begin(), mpi::aint(0));
+    std::vector<std::int32_t> in_place(size, -1);
+    in_place[rank] = rank;
+    communicator.all_gather_varying(MPI_IN_PLACE, 0, mpi::data_type(MPI_DATATYPE_NULL), in_place.data(), sizes, displacements, mpi::data_type(MPI_INT));
+    for (std::int32_t i = 0; i < size; ++i)
+      REQUIRE(in_place[i] == i);
+  }
+
+  {
+    std::vector<mpi::count>   sizes   (size, 1);
+    std::vector<std::int32_t> received;
+    communicator.gather_varying(std::vector<std::int32_t>{rank}, received, sizes, 0, true);
+    if (rank == 0)
+      for (std::int32_t i = 0; i < size; ++i)
+        REQUIRE(received[i] == i);
+
+    std::vector<std::int32_t> sent(size);
+    std::iota(sent.begin(), sent.end(), 0);
+    std::vector<std::int32_t> scattered(1);
+    communicator.scatter_varying(sent, scattered, sizes, 0);
+    REQUIRE(scattered[0] == rank);
+  }
+
+  // Sizes exceeding the (lowered) threshold are split into two chunks and a remainder.
+  constexpr mpi::count large = 2500;
+
+  {
+    std::vector<std::int32_t> data(large, rank);
+    communicator.all_reduce(data);
+    REQUIRE(data[large - 1] == size * (size - 1) / 2);
+
+    std::vector<std::int32_t> sent(large, 1), received(large);
+    communicator.reduce(sent, received, mpi::ops::sum, 0);
+    if (rank == 0)
+      REQUIRE(std::all_of(received.begin(), received.end(), [&] (const std::int32_t value) { return value == size; }));
+  }
+
+  // Every send mode transfers a single message of the large count data type, hence blocking and immediate operations match each other.
+  if (size > 1)
+  {
+    std::vector<std::int32_t> data(large);
+    if (rank == 0)
+    {
+      std::iota(data.begin(), data.end(), 0);
+      communicator.send(data, 1, 0);
+      communicator.immediate_send(data, 1, 1).wait();
+    }
+    else if (rank == 1)
+    {
+      const auto status = communicator.immediate_receive(data, 0, 0).wait();
+      REQUIRE(status.count_x(mpi::data_type(MPI_INT)) == large);
+      REQUIRE(data[large - 1] == large - 1);
+
+      std::fill(data.begin(), data.end(), 0);
+      communicator.receive(data, 0, 1);
+      REQUIRE(data[large - 1] == large - 1);
+    }
+  }
+
+  {
+    std::vector<mpi::count>   sizes   (size, large);
+    std::vector<std::int32_t> sent    (large * size);
+    for (std::int32_t i = 0; i < size; ++i)
+      std::fill_n(sent.begin() + large * i, large, rank * size + i);
+    std::vector<std::int32_t> received;
+    communicator.all_to_all_varying(sent, sizes, received, sizes, true);
+    for (std::int32_t i = 0; i < size; ++i)
+    {
+      REQUIRE(received[large * i            ] == i * size + rank);
+      REQUIRE(received[large * i + large - 1] == i * size + rank);
+    }
+  }
+
+  {
+    std::vector<mpi::count>   sizes        (size, large);
+    std::vector<mpi::aint>    displacements(size);
+    std::exclusive_scan(sizes.begin(), sizes.end(), displacements.begin(), mpi::aint(0));
+    std::vector<std::int32_t> in_place     (large * size, -1);
+    std::fill_n(in_place.begin() + large * rank, large, rank);
+    communicator.all_gather_varying(MPI_IN_PLACE, 0, mpi::data_type(MPI_DATATYPE_NULL), in_place.data(), sizes, displacements, mpi::data_type(MPI_INT));
+    for (std::int32_t i = 0; i < size; ++i)
+    {
+      REQUIRE(in_place[large * i            ] == i);
+      REQUIRE(in_place[large * i + large - 1] == i);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Make Op Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    // Element-wise: maximum absolute value.
+    const auto maximum_absolute = mpi::make_op<std::int32_t>([ ] (const std::int32_t& lhs, const std::int32_t& rhs)
+    {
+      return std::max(std::abs(lhs), std::abs(rhs));
+    });
+
+    std::vector<std::int32_t> data {-rank, rank, -2 * rank};
+    communicator.all_reduce(data, maximum_absolute);
+    REQUIRE(data[0] == size - 1);
+    REQUIRE(data[1] == size - 1);
+    REQUIRE(data[2] == 2 * (size - 1));
+  }
+
+  {
+    // On spans: the envelope [minimum, maximum] of interleaved pairs.
+    const auto envelope = mpi::make_op<double>([ ] (std::span<const double> input, std::span<double> input_output)
+    {
+      for (std::size_t i = 0; i + 1 < input.size(); i += 2)
+      {
+        input_output[i    ] = std::min(input[i    ], input_output[i    ]);
+        input_output[i + 1] = std::max(input[i + 1], input_output[i + 1]);
+      }
+    });
+
+    std::vector<double> data {static_cast<double>(rank), static_cast<double>(rank)};
+    communicator.all_reduce(data, envelope);
+    REQUIRE(data[0] == 0.0);
+    REQUIRE(data[1] == static_cast<double>(size - 1));
+  }
+
+  {
+    // Non-commutative: keeps the value of the lowest rank.
+    const auto first = mpi::make_op<std::int32_t>([ ] (const std::int32_t& lhs, const std::int32_t& rhs)
+    {
+      return lhs;
+    }, false);
+
+    std::int32_t data(rank + 10);
+    communicator.all_reduce(data, first);
+    REQUIRE(data == 10);
+  }
+}
\ No newline at end of file
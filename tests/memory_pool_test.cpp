@@ -0,0 +1,90 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <memory_resource>
+#include <thread>
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Memory Pool Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    auto location = mpi::allocate<std::int32_t>(16 * sizeof(std::int32_t));
+    REQUIRE(location != nullptr);
+    location[15] = 42;
+    mpi::free(location);
+  }
+
+  {
+    mpi::memory_pool pool(std::size_t(1) << 20, 4);
+    REQUIRE(mpi::memory_pool::size_class(1   ) == 0);
+    REQUIRE(mpi::memory_pool::size_class(64  ) == 0);
+    REQUIRE(mpi::memory_pool::size_class(65  ) == 1);
+    REQUIRE(mpi::memory_pool::size_class(mpi::memory_pool::maximum_block_size) == mpi::memory_pool::class_count - 1);
+
+    // Blocks are reused rather than allocated anew, and are aligned to their size.
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+      blocks.push_back(pool.allocate(256));
+      REQUIRE(reinterpret_cast<std::uintptr_t>(blocks.back()) % 256 == 0);
+      std::memset(blocks.back(), static_cast<std::int32_t>(i), 256);
+    }
+    REQUIRE(std::set<void*>(blocks.begin(), blocks.end()).size() == blocks.size());
+    const auto allocated = pool.allocated_size();
+    for (const auto block : blocks)
+      pool.deallocate(block, 256);
+    for (std::size_t i = 0; i < 100; ++i)
+      blocks[i] = pool.allocate(200);
+    REQUIRE(pool.allocated_size() == allocated);
+    for (const auto block : blocks)
+      pool.deallocate(block, 200);
+
+    auto aligned = pool.allocate(8, 1024);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 1024 == 0);
+    pool.deallocate(aligned, 8, 1024);
+
+    // Allocations exceeding the largest class are not pooled.
+    const auto before = pool.allocated_size();
+    auto       large  = pool.allocate(mpi::memory_pool::maximum_block_size + 1);
+    REQUIRE(pool.allocated_size() == before + mpi::memory_pool::maximum_block_size + 1);
+    pool.deallocate(large, mpi::memory_pool::maximum_block_size + 1);
+    REQUIRE(pool.allocated_size() == before);
+
+    // Blocks freed by other threads return to the pool.
+    std::vector<std::thread> threads;
+    for (std::int32_t i = 0; i < 4; ++i)
+      threads.emplace_back([&pool]
+      {
+        for (std::int32_t j = 0; j < 1000; ++j)
+        {
+          auto block = pool.allocate(static_cast<std::size_t>(64 << (j % 4)));
+          static_cast<char*>(block)[0] = 1;
+          pool.deallocate(block, static_cast<std::size_t>(64 << (j % 4)));
+        }
+      });
+    for (auto& thread : threads)
+      thread.join();
+  }
+
+  {
+    // Containers in registered memory used as communication buffers.
+    mpi::memory_pool          pool    ;
+    mpi::memory_pool_resource resource(pool);
+
+    std::pmr::vector<std::int32_t> sent    (1000, rank, &resource);
+    std::pmr::vector<std::int32_t> received(1000, -1  , &resource);
+    communicator.send_receive(sent, (rank + 1) % size, 0, received, (rank + size - 1) % size, 0);
+    REQUIRE(received == std::pmr::vector<std::int32_t>(1000, (rank + size - 1) % size));
+
+    std::pmr::memory_resource& other = resource;
+    REQUIRE(resource.is_equal(other));
+    REQUIRE(!resource.is_equal(*std::pmr::new_delete_resource()));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+struct edge
+{
+  std::int32_t origin;
+  std::int32_t hops  ;
+};
+
+TEST_CASE("Message Aggregator Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  constexpr std::int32_t records = 1000;
+
+  {
+    // Small thresholds, such that each destination receives several messages.
+    std::vector<std::int64_t>        received(size, 0);
+    mpi::message_aggregator<edge>    aggregator(communicator, [&] (const edge& record, const std::int32_t source)
+    {
+      REQUIRE(record.origin == source);
+      received[source] += record.hops;
+    }, mpi::aggregation_policy {16, 1024, 1.0});
+
+    for (std::int32_t i = 0; i < records; ++i)
+    {
+      aggregator.send({rank, i}, (rank + i) % size);
+      if (i % 100 == 0)
+        aggregator.progress();
+    }
+    aggregator.synchronize();
+
+    for (std::int32_t i = 0; i < size; ++i)
+    {
+      std::int64_t expected = 0;
+      for (std::int32_t j = 0; j < records; ++j)
+        if ((i + j) % size == rank)
+          expected += j;
+      REQUIRE(received[i] == expected);
+    }
+  }
+
+  {
+    // Records forwarded by the handler are dispatched within the same synchronization.
+    std::int64_t                     arrived = 0;
+    mpi::message_aggregator<edge>*   pointer = nullptr;
+    mpi::message_aggregator<edge>    aggregator(communicator, [&] (const edge& record, const std::int32_t)
+    {
+      if (record.hops > 0)
+        pointer->send({rank, record.hops - 1}, (rank + 1) % size);
+      else
+        ++arrived;
+    }, mpi::aggregation_policy {4, 1024, 1.0}, 1);
+    pointer = &aggregator;
+
+    for (std::int32_t i = 0; i < records; ++i)
+      aggregator.send({rank, 3}, (rank + 1) % size);
+    aggregator.synchronize();
+    REQUIRE(arrived == records);
+
+    // Records are sent by progress once the delay has passed, even if the thresholds are not reached.
+    mpi::message_aggregator<edge>    delayed(communicator, [&] (const edge&, const std::int32_t) { ++arrived; }, mpi::aggregation_policy {1024, 1 << 16, 0.0}, 2);
+    delayed.send({rank, 0}, (rank + 1) % size);
+    while (arrived == records)
+      delayed.progress();
+    delayed.synchronize();
+    REQUIRE(arrived == records + 1);
+
+    // Sending checks the delay as well, hence records buffered for other destinations are sent without progress.
+    mpi::message_aggregator<edge>    sending(communicator, [&] (const edge&, const std::int32_t) { ++arrived; }, mpi::aggregation_policy {1024, 1 << 16, 0.0}, 3);
+    sending.send({rank, 0}, rank);
+    for (const auto start = mpi::wall_clock_time(); mpi::wall_clock_time() == start;);
+    sending.send({rank, 0}, (rank + 1) % size);
+
+    std::optional<mpi::status> probed;
+    for (const auto start = mpi::wall_clock_time(); !probed && mpi::wall_clock_time() - start < 10.0;)
+      probed = communicator.immediate_probe(rank, 3);
+    REQUIRE(probed.has_value());
+    sending.synchronize();
+    REQUIRE(arrived == records + 3);
+
+    // Destroying the aggregator sends the records still buffered and waits for the pending sends.
+    edge leftover {};
+    auto request = communicator.immediate_receive(&leftover, sizeof(edge), mpi::data_types::byte, (rank + size - 1) % size, 4);
+    {
+      mpi::message_aggregator<edge>  destroyed(communicator, [&] (const edge&, const std::int32_t) { ++arrived; }, mpi::aggregation_policy {1024, 1 << 16, 1e9}, 4);
+      destroyed.send({rank, 7}, (rank + 1) % size);
+    }
+    request.wait();
+    REQUIRE(leftover.origin == (rank + size - 1) % size);
+    REQUIRE(leftover.hops   == 7);
+  }
+}
\ No newline at end of file
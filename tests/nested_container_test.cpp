@@ -0,0 +1,56 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Nested Container Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    // Process i contributes i + 1 inner containers of lengths 0, 1, ..., i.
+    std::vector<std::vector<std::int32_t>> sent(rank + 1);
+    for (std::int32_t i = 0; i <= rank; ++i)
+      sent[i] = std::vector<std::int32_t>(i, rank);
+
+    std::vector<std::vector<std::int32_t>> received;
+    communicator.all_gather_varying(sent, received);
+    REQUIRE(received.size() == static_cast<std::size_t>(size * (size + 1) / 2));
+    REQUIRE(received.front().empty());
+    REQUIRE(received.back ().size() == static_cast<std::size_t>(size - 1));
+    if (size > 1)
+      REQUIRE(received.back().front() == size - 1);
+  }
+
+  {
+    const std::vector<std::string> sent {"process " + std::to_string(rank), ""};
+
+    std::vector<std::string> received;
+    communicator.gather_varying(sent, received, 0);
+    if (rank == 0)
+    {
+      REQUIRE(received.size() == static_cast<std::size_t>(2 * size));
+      REQUIRE(received[2 * (size - 1)] == "process " + std::to_string(size - 1));
+      REQUIRE(received[1].empty());
+    }
+    else
+      REQUIRE(received.empty());
+  }
+
+  {
+    // Process i sends the string "i->j" to each process j.
+    std::vector<std::string> sent;
+    for (std::int32_t i = 0; i < size; ++i)
+      sent.push_back(std::to_string(rank) + "->" + std::to_string(i));
+
+    std::vector<std::string> received;
+    communicator.all_to_all_varying(sent, std::vector<std::int32_t>(size, 1), received);
+    REQUIRE(received.size() == static_cast<std::size_t>(size));
+    for (std::int32_t i = 0; i < size; ++i)
+      REQUIRE(received[i] == std::to_string(i) + "->" + std::to_string(rank));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Pipeline Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  const mpi::pipeline_policy policy {16, 5, 3};
+
+  {
+    std::vector<std::int32_t> data(103, rank == 0 ? 1 : 0);
+    data.back() = rank == 0 ? 42 : 0;
+    communicator.pipelined_broadcast(data, 0, policy);
+    REQUIRE(data.front() == 1 );
+    REQUIRE(data.back () == 42);
+  }
+
+  {
+    std::vector<std::int32_t> data(103, rank + 1);
+    communicator.pipelined_all_reduce(data, mpi::ops::sum, policy);
+    REQUIRE(data.front() == size * (size + 1) / 2);
+    REQUIRE(data.back () == size * (size + 1) / 2);
+  }
+
+  if (size > 1 && rank < 2)
+  {
+    std::vector<std::int32_t> data(103);
+    if (rank == 0)
+    {
+      std::iota(data.begin(), data.end(), 0);
+      communicator.pipelined_send(data, 1, 7, policy);
+    }
+    else
+    {
+      const auto status = communicator.pipelined_receive(data, MPI_ANY_SOURCE, MPI_ANY_TAG, policy);
+      REQUIRE(status.source() == 0);
+      REQUIRE(status.tag   () == 7);
+      REQUIRE(data[0 ] == 0 );
+      REQUIRE(data[50] == 50);
+      REQUIRE(data.back() == 102);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Probe Receive Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+
+  if (communicator.size() < 2 || rank > 1)
+    return;
+
+  if (rank == 0)
+  {
+    communicator.send(std::vector<std::int32_t>{1, 2, 3}, 1, 0);
+    communicator.send(std::vector<std::int32_t>{4, 5, 6, 7, 8}, 1, 1);
+    communicator.send(std::vector<std::array<std::int32_t, 2>>{{1, 2}, {3, 4}}, 1, 2);
+  }
+  else
+  {
+    std::vector<std::int32_t> data;
+    communicator.receive(data, 0, 0, true);
+    REQUIRE(data.size() == 3);
+    REQUIRE(data[2]     == 3);
+
+    std::optional<mpi::request> request;
+    while (!request)
+      request = communicator.immediate_probe_receive(data, 0, 1);
+    request->wait();
+    REQUIRE(data.size() == 5);
+    REQUIRE(data[4]     == 8);
+
+    // The count of derived data types is not the number of basic elements.
+    std::vector<std::array<std::int32_t, 2>> pairs;
+    communicator.receive(pairs, 0, 2, true);
+    REQUIRE(pairs.size() == 2);
+    REQUIRE(pairs[1][1]  == 4);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Reproducible Reduce Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    // Catastrophic cancellation, which a floating-point sum only resolves in particular orders.
+    const std::vector<double> values {1e100, 1.0, -1e100, 1e-300, -3.0, 4.9e-324};
+
+    mpi::exact_accumulator forward;
+    for (auto iterator = values.begin(); iterator != values.end(); ++iterator)
+      forward.add(*iterator);
+    mpi::exact_accumulator backward;
+    for (auto iterator = values.rbegin(); iterator != values.rend(); ++iterator)
+      backward.add(*iterator);
+
+    REQUIRE(forward.value() == -2.0);
+    REQUIRE(std::equal(forward.data(), forward.data() + mpi::exact_accumulator::limb_count, backward.data()));
+  }
+
+  {
+    const auto value = [ ] (const std::int32_t element, const std::int32_t process)
+    {
+      return (process % 2 == 0 ? 1.0 : -1.0) * std::ldexp(1.0 + 1.0 / (element + process + 3), (element * 37 + process * 53) % 120 - 60);
+    };
+
+    std::vector<double> sent    (64);
+    std::vector<double> received(64);
+    for (std::size_t i = 0; i < sent.size(); ++i)
+      sent[i] = value(static_cast<std::int32_t>(i), rank);
+
+    communicator.reproducible_all_reduce(sent, received);
+    for (std::size_t i = 0; i < received.size(); ++i)
+    {
+      mpi::exact_accumulator expected;
+      for (auto process = size - 1; process >= 0; --process)
+        expected.add(value(static_cast<std::int32_t>(i), process));
+      REQUIRE(received[i] == expected.value());
+    }
+
+    communicator.reproducible_reduce(sent, 0);
+    if (rank == 0)
+      REQUIRE(sent == received);
+  }
+
+  {
+    std::vector<double> data {1e16 * (rank % 2 == 0 ? 1.0 : -1.0), 0.1};
+    communicator.reproducible_all_reduce(data);
+    REQUIRE(data[0] == (size % 2 == 0 ? 0.0 : 1e16));
+
+    std::vector<float> floats {static_cast<float>(rank)};
+    communicator.reproducible_reduce(floats, 0);
+    if (rank == 0)
+      REQUIRE(floats[0] == static_cast<float>(size * (size - 1) / 2));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Request Set Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  std::vector<std::int32_t> sent    (size, rank);
+  std::vector<std::int32_t> received(size, -1);
+
+  {
+    mpi::request_set requests(2 * size);
+    for (std::int32_t i = 0; i < size; ++i)
+    {
+      requests.insert(communicator.immediate_receive(received[i], i, 0));
+      requests.insert(communicator.immediate_send   (sent    [i], i, 0));
+    }
+    REQUIRE(requests.size() == static_cast<std::size_t>(2 * size));
+
+    requests.wait_all();
+    for (std::int32_t i = 0; i < size; ++i)
+    {
+      REQUIRE(received[i] == i);
+      REQUIRE(requests.status(2 * i).source() == i);
+    }
+    REQUIRE(requests.test_all());
+    REQUIRE(!requests.wait_any().has_value());
+    REQUIRE(requests.wait_some().empty());
+  }
+
+  {
+    std::fill(received.begin(), received.end(), -1);
+
+    mpi::request_set requests;
+    for (std::int32_t i = 0; i < size; ++i)
+      requests.insert(communicator.immediate_receive(received[i], i, 1));
+    for (std::int32_t i = 0; i < size; ++i)
+      communicator.send(sent[i], i, 1);
+
+    std::size_t completed(0);
+    while (completed < requests.size())
+      for (const auto index : requests.wait_some())
+      {
+        REQUIRE(received[index] == index);
+        REQUIRE(requests.status(index).tag() == 1);
+        ++completed;
+      }
+  }
+
+  {
+    std::fill(received.begin(), received.end(), -1);
+
+    std::vector<mpi::request> persistent;
+    for (std::int32_t i = 0; i < size; ++i)
+    {
+      persistent.push_back(communicator.persistent_receive(received[i], i, 2));
+      persistent.push_back(communicator.persistent_send   (sent    [i], i, 2));
+    }
+
+    mpi::request_set requests(std::move(persistent));
+    for (auto iteration = 0; iteration < 3; ++iteration)
+    {
+      requests.start_all();
+      requests.wait_all ();
+    }
+    for (std::int32_t i = 0; i < size; ++i)
+      REQUIRE(received[i] == i);
+  }
+}
\ No newline at end of file
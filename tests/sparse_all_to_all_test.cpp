@@ -0,0 +1,59 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Sparse All To All Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  const auto neighbors = [&] (const std::int32_t process)
+  {
+    return std::set<std::int32_t> {(process + 1) % size, (process + 3) % size};
+  };
+
+  {
+    std::map<std::int32_t, std::vector<std::int32_t>> sent;
+    for (const auto neighbor : neighbors(rank))
+      sent[neighbor] = std::vector<std::int32_t>(static_cast<std::size_t>(neighbor + rank + 1), rank);
+
+    const auto received = communicator.sparse_all_to_all(sent);
+
+    std::set<std::int32_t> sources;
+    for (std::int32_t i = 0; i < size; ++i)
+      if (neighbors(i).contains(rank))
+        sources.insert(i);
+
+    REQUIRE(received.size() == sources.size());
+    for (const auto source : sources)
+    {
+      REQUIRE(received.contains(source));
+      REQUIRE(received.at(source) == std::vector<std::int32_t>(static_cast<std::size_t>(rank + source + 1), source));
+    }
+  }
+
+  {
+    // Only even processes send, and consecutive exchanges use distinct tags.
+    for (std::int32_t tag = 1; tag <= 3; ++tag)
+    {
+      std::map<std::int32_t, std::vector<double>> sent;
+      if (rank % 2 == 0)
+        sent[(rank + tag) % size] = {static_cast<double>(rank), static_cast<double>(tag)};
+
+      const auto received = communicator.sparse_all_to_all(sent, tag);
+
+      std::size_t expected = 0;
+      for (std::int32_t i = 0; i < size; i += 2)
+        if ((i + tag) % size == rank)
+        {
+          ++expected;
+          REQUIRE(received.at(i) == std::vector<double> {static_cast<double>(i), static_cast<double>(tag)});
+        }
+      REQUIRE(received.size() == expected);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Thread Pool Test")
+{
+  mpi::environment environment  (nullptr, nullptr, mpi::thread_support::multiple);
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  {
+    std::atomic<std::size_t> count(0);
+    {
+      mpi::thread_pool pool(4);
+      REQUIRE(pool.thread_count() == 4);
+      for (std::size_t i = 0; i < 1000; ++i)
+        pool.submit([&] { count.fetch_add(1); }, {i % 3 == 0 ? std::optional<std::size_t>(0) : std::nullopt, i % 2 == 0});
+    }
+    REQUIRE(count == 1000);
+  }
+
+  {
+    // A long task queued on one worker does not delay the tasks queued behind it, which are stolen by the others.
+    std::atomic<std::size_t> count(0);
+    std::atomic<bool>        released(false);
+    mpi::thread_pool         pool(2);
+    pool.submit([&] { while (!released) std::this_thread::yield(); }, {0});
+    for (std::size_t i = 0; i < 10; ++i)
+      pool.submit([&] { count.fetch_add(1); }, {0});
+    while (count != 10)
+      std::this_thread::yield();
+    released = true;
+  }
+
+  {
+    // The callbacks of detached requests run on the executor threads, while the progress thread keeps completing requests.
+    // Tasks must not throw, hence the callbacks only record the tags, which are checked once the context has joined its threads.
+    constexpr std::int32_t    count = 256;
+    std::vector<std::int32_t> sent(count), received(count, -1), tags(count, -1);
+    std::atomic<std::int32_t> completed(0);
+    std::mutex                mutex;
+    std::set<std::thread::id> threads;
+    {
+      mpi::detach_context context(true, {}, 4);
+      for (std::int32_t i = 0; i < count; ++i)
+      {
+        sent[i] = rank * count + i;
+        auto request = communicator.immediate_receive(received[i], (rank + size - 1) % size, i);
+        context.detach(request, [&, i] (const mpi::status& status)
+        {
+          tags[i] = status.tag();
+          if (i % 64 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          {
+            std::unique_lock lock(mutex);
+            threads.insert(std::this_thread::get_id());
+          }
+          completed.fetch_add(1);
+        }, {std::nullopt, i % 64 == 0});
+      }
+
+      std::vector<mpi::request> requests;
+      for (std::int32_t i = 0; i < count; ++i)
+        requests.push_back(communicator.immediate_send(sent[i], (rank + 1) % size, i));
+      mpi::wait_all(requests);
+    }
+    REQUIRE(completed == count);
+    REQUIRE(!threads.contains(std::this_thread::get_id()));
+    for (std::int32_t i = 0; i < count; ++i)
+    {
+      REQUIRE(tags    [i] == i);
+      REQUIRE(received[i] == ((rank + size - 1) % size) * count + i);
+    }
+  }
+
+  communicator.barrier();
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Topology Descriptor Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+
+  const auto& descriptor = mpi::cached_topology_descriptor(communicator);
+  REQUIRE(&descriptor == &mpi::cached_topology_descriptor(communicator));
+  REQUIRE(&descriptor == &mpi::cached_topology_descriptor(mpi::communicator(communicator.native())));
+
+  REQUIRE(descriptor.rank                () == rank);
+  REQUIRE(descriptor.size                () == size);
+  REQUIRE(descriptor.topology            () == mpi::topology::undefined);
+  REQUIRE(descriptor.is_intercommunicator() == false);
+  REQUIRE(descriptor.hostname            () == mpi::processor_name());
+
+  // All processes of the test share a machine.
+  REQUIRE(descriptor.node_count() == 1);
+  REQUIRE(descriptor.node_index() == 0);
+  REQUIRE(descriptor.node_size () == size);
+  REQUIRE(descriptor.node_rank () == descriptor.node_rank(rank));
+  REQUIRE(descriptor.is_leader () == (descriptor.node_rank() == 0));
+  if (descriptor.is_leader())
+    REQUIRE(descriptor.leaders().size() == 1);
+
+  {
+    // Emulated nodes of two processes each.
+    mpi::communicator              duplicate(communicator);
+    const mpi::topology_descriptor pairs(duplicate, rank / 2);
+    REQUIRE(pairs.node_count() == (size + 1) / 2);
+    REQUIRE(pairs.node_index() == rank / 2);
+    REQUIRE(pairs.node_rank () == rank % 2);
+    REQUIRE(pairs.node_size () == std::min(2, size - 2 * (rank / 2)));
+    for (std::int32_t i = 0; i < pairs.node_count(); ++i)
+      REQUIRE(pairs.node_offset(i) == 2 * i);
+    if (pairs.is_leader())
+      REQUIRE(pairs.leaders().size() == pairs.node_count());
+
+    // The cached descriptor is not inherited by duplicates.
+    REQUIRE(&mpi::cached_topology_descriptor(duplicate) != &descriptor);
+  }
+}
\ No newline at end of file
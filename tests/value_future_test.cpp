@@ -0,0 +1,87 @@
+#include "internal/doctest.h"
+
+#define MPI_USE_EXCEPTIONS
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <mpi/all.hpp>
+
+TEST_CASE("Value Future Test")
+{
+  mpi::environment environment  ;
+  const auto&      communicator = mpi::world_communicator;
+  const auto       rank         = communicator.rank();
+  const auto       size         = communicator.size();
+  const auto       next         = (rank + 1       ) % size;
+  const auto       previous     = (rank + size - 1) % size;
+
+  {
+    // The size of the received container is that of the message.
+    auto vector = mpi::async_receive<std::vector<std::int32_t>>(communicator, previous, 1);
+    auto scalar = mpi::async_receive<std::int32_t>             (communicator, previous, 2);
+    REQUIRE(!vector.is_ready()); // No process sends before all have passed the barrier.
+    communicator.barrier();
+
+    std::vector<std::int32_t> sent(static_cast<std::size_t>(rank) + 3);
+    std::iota(sent.begin(), sent.end(), rank);
+    auto first  = communicator.immediate_send(sent, next, 1);
+    auto second = communicator.immediate_send(rank, next, 2);
+
+    auto moved    = std::move(vector); // The buffer does not move along with the future.
+    auto received = moved.get();
+    REQUIRE(!moved.valid());
+    REQUIRE(received.size() == static_cast<std::size_t>(previous) + 3);
+    for (std::size_t i = 0; i < received.size(); ++i)
+      REQUIRE(received[i] == previous + static_cast<std::int32_t>(i));
+    REQUIRE(scalar.wait().tag() == 2);
+    REQUIRE(scalar.get() == previous);
+
+    first .wait();
+    second.wait();
+  }
+
+  {
+    auto sum = mpi::async_all_reduce(communicator, std::vector<std::int32_t>{rank, 1});
+    auto max = mpi::async_all_reduce(communicator, rank, mpi::ops::maximum);
+    REQUIRE(sum.get() == std::vector<std::int32_t>{size * (size - 1) / 2, size});
+    REQUIRE(max.get() == size - 1);
+  }
+
+  {
+    // The sent data is owned by the future as well.
+    auto gathered = mpi::async_gather(communicator, std::vector<std::int32_t>{rank, -rank}, size - 1);
+    auto result   = gathered.get();
+    if (rank == size - 1)
+    {
+      REQUIRE(result.size() == 2 * static_cast<std::size_t>(size));
+      for (std::int32_t i = 0; i < size; ++i)
+      {
+        REQUIRE(result[2 * i    ] ==  i);
+        REQUIRE(result[2 * i + 1] == -i);
+      }
+    }
+    else
+      REQUIRE(result.empty());
+  }
+
+  {
+    // Move assigning over a pending receive waits for it, rather than freeing the buffer it receives into.
+    auto pending = mpi::async_receive<std::int32_t>(communicator, previous, 3);
+    auto first   = communicator.immediate_send(rank, next, 3);
+    pending      = mpi::async_receive<std::int32_t>(communicator, previous, 4);
+    auto value   = rank + size;
+    auto second  = communicator.immediate_send(value, next, 4);
+    REQUIRE(pending.get() == previous + size);
+    first .wait();
+    second.wait();
+  }
+
+  {
+    // Destroying a started future waits for its operation.
+    auto scalar = mpi::async_all_reduce(communicator, 1);
+  }
+
+  communicator.barrier();
+}
\ No newline at end of file